@@ -16,15 +16,22 @@
 
 #include "config.h"
 
+#include "dbus_paths.hpp"
 #include "sdbusplus.hpp"
 
 #include <CLI/CLI.hpp>
 #include <nlohmann/json.hpp>
 #include <sdbusplus/bus.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <filesystem>
+#include <format>
 #include <iomanip>
 #include <iostream>
+#include <optional>
+#include <set>
+#include <variant>
 
 using SDBusPlus = phosphor::fan::util::SDBusPlus;
 
@@ -57,6 +64,39 @@ struct SensorOpts
     bool verbose{false};
 };
 
+struct LatencyOpts
+{
+    bool on{false};
+    bool off{false};
+};
+
+struct WatchOpts
+{
+    bool json{false};
+};
+
+using WatchValue = std::variant<bool, uint64_t, double, std::string,
+                                std::vector<std::string>>;
+
+// How often 'fanctl watch' reads the zones from the dump
+constexpr auto zonePollInterval = std::chrono::seconds(1);
+
+struct WatchData
+{
+    std::string method;
+    std::vector<std::string> fanNames;
+    std::map<std::string, std::map<std::string, std::vector<std::string>>>
+        pathMap;
+    // The object paths with watched properties
+    std::set<std::string> paths;
+    // Zone object paths by zone name
+    std::map<std::string, std::string> zones;
+    // Property values by object path and property name
+    std::map<std::string, std::map<std::string, WatchValue>> values;
+    uint64_t updates{0};
+    std::chrono::system_clock::time_point lastUpdate;
+};
+
 struct SensorOutput
 {
     std::string name;
@@ -540,9 +580,71 @@ void reload()
 }
 
 /**
- * @function dump debug data
+ * @function Get a dump from fan control's Dump method, which only
+ *           serializes the sections asked for and returns an fd to read
+ *           the dump from.
+ *
+ * @param sections The sections to dump, where empty means all of them
+ * @return The dump, or nullopt if it couldn't be gotten this way, like
+ *         with a fan control without the method.
  */
-void dumpFanControl()
+std::optional<nlohmann::json> requestDump(
+    const std::vector<std::string>& sections)
+{
+    try
+    {
+        auto msg = SDBusPlus::callMethod(CONTROL_BUSNAME, DUMP_OBJPATH,
+                                         DUMP_INTERFACE, "Dump", sections);
+
+        // The message owns its fd, so read from a copy of it
+        sdbusplus::message::unix_fd fd;
+        msg.read(fd);
+        auto file = fdopen(dup(fd), "r");
+        if (file == nullptr)
+        {
+            return std::nullopt;
+        }
+
+        auto dumpData = nlohmann::json::parse(file, nullptr, false);
+        fclose(file);
+        if (dumpData.is_discarded())
+        {
+            return std::nullopt;
+        }
+        return dumpData;
+    }
+    catch (const std::exception&)
+    {
+        return std::nullopt;
+    }
+}
+
+/**
+ * @function Read the dump file
+ *
+ * @return The dump, or nullopt if it isn't there or isn't valid
+ */
+std::optional<nlohmann::json> readDumpFile()
+{
+    std::ifstream file{dumpFile};
+    if (!file.good())
+    {
+        return std::nullopt;
+    }
+
+    auto dumpData = nlohmann::json::parse(file, nullptr, false);
+    if (dumpData.is_discarded())
+    {
+        return std::nullopt;
+    }
+    return dumpData;
+}
+
+/**
+ * @function dump debug data by sending fan control the USR1 signal and
+ *           waiting for the dump file to show up
+ */
+void signalDump()
 {
     namespace fs = std::filesystem;
 
@@ -593,22 +695,59 @@ void dumpFanControl()
 }
 
 /**
- * @function Query items in the dump file
+ * @function dump debug data
  */
-void queryDumpFile(const DumpQuery& dq)
+void dumpFanControl()
 {
-    nlohmann::json output;
-    std::ifstream file{dumpFile};
+    auto dumpData = requestDump({});
+    if (!dumpData)
+    {
+        signalDump();
+        return;
+    }
 
-    if (!file.good())
+    std::ofstream file{dumpFile};
+    file << std::setw(4) << *dumpData;
+    if (!file)
     {
-        std::cerr << "Unable to open dump file, please run 'fanctl dump'.\n";
+        std::cerr << "Unable to write fan control dump to " << dumpFile
+                  << std::endl;
         return;
     }
 
-    auto dumpData = nlohmann::json::parse(file);
+    std::cout << "Fan control dump written to: " << dumpFile << std::endl;
+}
+
+/**
+ * @function Query items in the dump file, or in a fresh dump of just
+ *           the section being queried when forced.
+ */
+void queryDump(const DumpQuery& dq)
+{
+    nlohmann::json output;
+    std::optional<nlohmann::json> dumpData;
 
-    if (!dumpData.contains(dq.section))
+    if (dq.dump)
+    {
+        dumpData = requestDump({dq.section});
+        if (!dumpData)
+        {
+            dumpFanControl();
+        }
+    }
+
+    if (!dumpData)
+    {
+        dumpData = readDumpFile();
+        if (!dumpData)
+        {
+            std::cerr
+                << "Unable to open dump file, please run 'fanctl dump'.\n";
+            return;
+        }
+    }
+
+    if (!dumpData->contains(dq.section))
     {
         std::cerr << "Error: Dump file does not contain " << dq.section
                   << " section"
@@ -616,7 +755,7 @@ void queryDumpFile(const DumpQuery& dq)
         return;
     }
 
-    const auto& section = dumpData.at(dq.section);
+    const auto& section = dumpData->at(dq.section);
 
     if (section.is_array())
     {
@@ -675,6 +814,100 @@ void queryDumpFile(const DumpQuery& dq)
     }
 }
 
+/**
+ * @function Print the latency stats from a fresh dump, or turn collecting
+ *           them on or off by sending the USR2 signal.
+ *
+ * @param opts The latency options
+ */
+void latency(const LatencyOpts& opts)
+{
+    auto dumpData = requestDump({"latency"});
+    if (!dumpData)
+    {
+        dumpFanControl();
+        dumpData = readDumpFile();
+    }
+
+    if (!dumpData || !dumpData->contains("latency"))
+    {
+        std::cerr << "Error: Unable to read latency stats from dump file\n";
+        return;
+    }
+
+    const auto& stats = dumpData->at("latency");
+    bool enabled = stats.value("enabled", false);
+
+    if (opts.on || opts.off)
+    {
+        if (enabled != opts.on)
+        {
+            try
+            {
+                SDBusPlus::callMethod(systemdService, systemdPath,
+                                      systemdMgrIface, "KillUnit",
+                                      phosphorServiceName, "main", SIGUSR2);
+            }
+            catch (const phosphor::fan::util::DBusError& e)
+            {
+                std::cerr << "Unable to toggle latency stats: " << e.what()
+                          << std::endl;
+                return;
+            }
+        }
+        std::cout << "Latency stats " << (opts.on ? "enabled" : "disabled")
+                  << "\n";
+        return;
+    }
+
+    if (!enabled)
+    {
+        std::cout << "Latency stats are disabled, enable them with "
+                     "'fanctl latency --on'\n";
+    }
+
+    // Show where the most time is spent first
+    std::vector<std::pair<std::string, nlohmann::json>> stages;
+    for (const auto& [stage, values] : stats.items())
+    {
+        if (values.is_object() && (values.value("count", 0) != 0))
+        {
+            stages.emplace_back(stage, values);
+        }
+    }
+
+    std::ranges::sort(stages, [](const auto& left, const auto& right) {
+        auto total = [](const auto& values) {
+            return values.value("count", uint64_t{0}) *
+                   values.value("mean_us", uint64_t{0});
+        };
+        return total(left.second) > total(right.second);
+    });
+
+    size_t nameSize = std::string{"STAGE"}.size();
+    std::ranges::for_each(stages, [&nameSize](const auto& stage) {
+        nameSize = std::max(nameSize, stage.first.size());
+    });
+
+    std::cout << std::left << std::setw(nameSize + 2) << "STAGE" << std::right
+              << std::setw(10) << "COUNT" << std::setw(10) << "MEAN(us)"
+              << std::setw(10) << "P50(us)" << std::setw(10) << "P90(us)"
+              << std::setw(10) << "P99(us)" << std::setw(10) << "MAX(us)"
+              << "\n";
+
+    for (const auto& [stage, values] : stages)
+    {
+        std::cout << std::left << std::setw(nameSize + 2) << stage
+                  << std::right;
+        for (const auto& field :
+             {"count", "mean_us", "p50_us", "p90_us", "p99_us", "max_us"})
+        {
+            std::cout << std::setw(10) << values.value(field, uint64_t{0});
+        }
+        std::cout << "\n";
+    }
+}
+
 /**
  * @function Get the sensor type based on the sensor name
  *
@@ -862,11 +1095,492 @@ void displaySensors(const SensorOpts& opts)
     readSensorsAndPrint(managers, opts);
 }
 
+/**
+ * @function Returns a property value from 'fanctl watch' as a string
+ *
+ * @param values The properties of an object
+ * @param property The property name
+ */
+std::string watchValueString(
+    const std::map<std::string, WatchValue>* values,
+    const std::string& property)
+{
+    if (values == nullptr)
+    {
+        return "Unknown";
+    }
+
+    auto it = values->find(property);
+    if (it == values->end())
+    {
+        return "Unknown";
+    }
+
+    return std::visit(
+        [](const auto& value) -> std::string {
+            using T = std::decay_t<decltype(value)>;
+            if constexpr (std::is_same_v<T, bool>)
+            {
+                return value ? "true" : "false";
+            }
+            else if constexpr (std::is_same_v<T, std::string>)
+            {
+                return value;
+            }
+            else if constexpr (std::is_same_v<T, std::vector<std::string>>)
+            {
+                return "";
+            }
+            else
+            {
+                return std::format("{}", value);
+            }
+        },
+        it->second);
+}
+
+/**
+ * @function Converts a property value from 'fanctl watch' to JSON
+ *
+ * @param value The value
+ */
+nlohmann::json watchValueJson(const WatchValue& value)
+{
+    return std::visit([](const auto& v) { return nlohmann::json(v); }, value);
+}
+
+/**
+ * @function Renders the 'fanctl watch' table
+ *
+ * @param data The watched values
+ * @return the lines of the table
+ */
+std::vector<std::string> renderWatchTable(const WatchData& data)
+{
+    std::vector<std::string> lines;
+
+    auto find = [&data](const std::string& path) {
+        auto it = data.values.find(path);
+        return (it != data.values.end()) ? &it->second : nullptr;
+    };
+
+    auto first = [&find](const auto& paths, const std::string& fan) {
+        auto it = paths.find(fan);
+        return ((it != paths.end()) && !it->second.empty())
+                   ? find(it->second.front())
+                   : nullptr;
+    };
+
+    lines.push_back(std::format("{:<10}{:>14}{:>20}{:>10}{:>13}", "FAN",
+                                "TARGET(" + data.method + ")",
+                                "FEEDBACKS(RPM)", "PRESENT", "FUNCTIONAL"));
+    lines.push_back(std::string(67, '='));
+
+    for (const auto& fan : data.fanNames)
+    {
+        const auto& tachs = data.pathMap.at("tach");
+        std::string feedbacks;
+        if (auto it = tachs.find(fan); it != tachs.end())
+        {
+            for (const auto& path : it->second)
+            {
+                if (!feedbacks.empty())
+                {
+                    feedbacks += "/";
+                }
+                feedbacks += watchValueString(find(path), "Value");
+            }
+        }
+
+        lines.push_back(std::format(
+            "{:<10}{:>14}{:>20}{:>10}{:>13}", fan,
+            watchValueString(first(tachs, fan), "Target"), feedbacks,
+            watchValueString(first(data.pathMap.at("inventory"), fan),
+                             "Present"),
+            watchValueString(first(data.pathMap.at("opstatus"), fan),
+                             "Functional")));
+    }
+
+    if (!data.zones.empty())
+    {
+        lines.emplace_back();
+        lines.push_back(std::format("{:<10}{:>14}{:>12}{:>12}", "ZONE",
+                                    "TARGET", "FLOOR", "CEILING"));
+        lines.push_back(std::string(67, '='));
+
+        for (const auto& [zone, path] : data.zones)
+        {
+            auto values = find(path);
+            lines.push_back(std::format(
+                "{:<10}{:>14}{:>12}{:>12}", zone,
+                watchValueString(values, "Target"),
+                watchValueString(values, "Floor"),
+                watchValueString(values, "Ceiling")));
+        }
+    }
+
+    lines.emplace_back();
+    lines.push_back(std::format("{} updates, last at {:%T}", data.updates,
+                                std::chrono::floor<std::chrono::seconds>(
+                                    data.lastUpdate)));
+
+    return lines;
+}
+
+/**
+ * @function Redraws only the lines of the 'fanctl watch' table that
+ *           changed, or all of it when the number of lines changed.
+ *
+ * @param lines The new lines
+ * @param shown The lines on the screen, which are updated
+ */
+void redrawWatchTable(const std::vector<std::string>& lines,
+                      std::vector<std::string>& shown)
+{
+    if (lines.size() != shown.size())
+    {
+        // Clear the screen
+        std::cout << "\x1b[H\x1b[2J";
+        shown.assign(lines.size(), "");
+    }
+
+    for (size_t i = 0; i < lines.size(); i++)
+    {
+        if (lines[i] != shown[i])
+        {
+            // Move to the line, write it, and clear the rest of it
+            std::cout << std::format("\x1b[{};1H{}\x1b[K", i + 1, lines[i]);
+            shown[i] = lines[i];
+        }
+    }
+
+    // Leave the cursor below the table
+    std::cout << std::format("\x1b[{};1H", lines.size() + 1) << std::flush;
+}
+
+/**
+ * @function Stores new property values for 'fanctl watch', and prints
+ *           them as JSON lines when that was asked for.
+ *
+ * @param data The watched values
+ * @param path The object path
+ * @param properties The new property values
+ * @param opts The watch options
+ */
+void updateWatchData(WatchData& data, const std::string& path,
+                     const std::map<std::string, WatchValue>& properties,
+                     const WatchOpts& opts)
+{
+    static const std::set<std::string> watched{
+        "Target", "Value", "Present", "Functional", "Floor", "Ceiling"};
+
+    auto time = std::chrono::system_clock::now();
+
+    for (const auto& [property, value] : properties)
+    {
+        if (!watched.contains(property))
+        {
+            continue;
+        }
+
+        data.values[path][property] = value;
+        data.updates++;
+        data.lastUpdate = time;
+
+        if (opts.json)
+        {
+            nlohmann::json line{
+                {"time",
+                 std::chrono::duration<double>(time.time_since_epoch())
+                     .count()},
+                {"name", justFanName(path)},
+                {"path", path},
+                {"property", property},
+                {"value", watchValueJson(value)}};
+            std::cout << line.dump() << std::endl;
+        }
+    }
+}
+
+/**
+ * @function Reads the initial values for 'fanctl watch'
+ *
+ * @param data The watched values, with the fans and paths filled in
+ * @param interfaces The fan interfaces by type
+ */
+void readWatchData(WatchData& data,
+                   std::map<const std::string, const std::string>& interfaces)
+{
+    auto read = [&data](const std::string& path, const std::string& interface,
+                        const std::string& property) {
+        try
+        {
+            data.values[path][property] =
+                SDBusPlus::getPropertyVariant<WatchValue>(path, interface,
+                                                          property);
+        }
+        catch (const std::exception&)
+        {
+            // Shown as Unknown until a signal comes
+        }
+    };
+
+    for (const auto& fan : data.fanNames)
+    {
+        const auto& tachs = data.pathMap["tach"][fan];
+        if (!tachs.empty())
+        {
+            read(tachs.front(), interfaces[ifaceTypeFromMethod(data.method)],
+                 "Target");
+        }
+
+        for (const auto& path : tachs)
+        {
+            read(path, interfaces["SensorValue"], "Value");
+        }
+
+        for (const auto& path : data.pathMap["inventory"][fan])
+        {
+            read(path, interfaces["Item"], "Present");
+        }
+
+        for (const auto& path : data.pathMap["opstatus"][fan])
+        {
+            read(path, interfaces["OpStatus"], "Functional");
+        }
+    }
+}
+
+/**
+ * @function Reads the zone targets, floors, and ceilings for 'fanctl
+ *           watch' from the zones section of fan control's dump, since
+ *           they aren't D-Bus properties that can be watched.
+ *
+ * @param data The watched values
+ * @param opts The watch options
+ * @return If any of the values changed
+ */
+bool readWatchZones(WatchData& data, const WatchOpts& opts)
+{
+    static const std::vector<std::pair<std::string, std::string>> fields{
+        {"Target", "target"}, {"Floor", "floor"}, {"Ceiling", "ceiling"}};
+
+    auto dumpData = requestDump({"zones"});
+    if (!dumpData || !dumpData->contains("zones"))
+    {
+        // Fan control isn't running, or doesn't have the Dump method
+        return false;
+    }
+
+    bool changed = false;
+    for (const auto& [zone, zoneData] : (*dumpData)["zones"].items())
+    {
+        auto path = std::string{CONTROL_OBJPATH} + "/" + zone;
+        data.zones.try_emplace(zone, path);
+
+        const auto& current = data.values[path];
+        std::map<std::string, WatchValue> properties;
+        for (const auto& [property, field] : fields)
+        {
+            if (!zoneData.contains(field))
+            {
+                continue;
+            }
+
+            WatchValue value = zoneData[field].get<uint64_t>();
+            auto it = current.find(property);
+            if ((it == current.end()) || (it->second != value))
+            {
+                properties.emplace(property, std::move(value));
+            }
+        }
+
+        if (!properties.empty())
+        {
+            updateWatchData(data, path, properties, opts);
+            changed = true;
+        }
+    }
+
+    return changed;
+}
+
+/**
+ * @function Finds the deepest object path that all of a type's paths
+ *           from the fan data are under, to subscribe to that namespace.
+ *
+ * @param paths The paths of each fan
+ * @return The common path, or nullopt when there are no paths
+ */
+std::optional<std::string> commonPathPrefix(
+    const std::map<std::string, std::vector<std::string>>& paths)
+{
+    namespace fs = std::filesystem;
+    std::optional<fs::path> prefix;
+
+    for (const auto& [fan, fanPaths] : paths)
+    {
+        for (const auto& path : fanPaths)
+        {
+            if (!prefix)
+            {
+                prefix = path;
+                continue;
+            }
+
+            fs::path objPath{path};
+            auto end = std::mismatch(prefix->begin(), prefix->end(),
+                                     objPath.begin(), objPath.end())
+                           .first;
+
+            fs::path common;
+            for (auto it = prefix->begin(); it != end; ++it)
+            {
+                common /= *it;
+            }
+            prefix = common;
+        }
+    }
+
+    if (!prefix)
+    {
+        return std::nullopt;
+    }
+    return prefix->string();
+}
+
+/**
+ * @function Watches the fan targets, tachs, presence, and functional
+ *           states using PropertiesChanged signals after reading them
+ *           once, and the zone targets, floors, and ceilings by reading
+ *           them from fan control's dump every zonePollInterval.  Runs
+ *           until interrupted.
+ *
+ * @param opts The watch options
+ */
+void watch(const WatchOpts& opts)
+{
+    auto& bus = SDBusPlus::getBus();
+
+    WatchData data;
+    auto busData = loadDBusData();
+    data.fanNames = std::get<FAN_NAMES>(busData);
+    data.pathMap = std::get<PATH_MAP>(busData);
+    data.method = std::get<METHOD>(busData);
+    auto interfaces = std::get<IFACES>(busData);
+
+    for (const auto& [type, paths] : data.pathMap)
+    {
+        for (const auto& [fan, fanPaths] : paths)
+        {
+            data.paths.insert(fanPaths.begin(), fanPaths.end());
+        }
+    }
+
+    // Subscribe before reading so nothing is missed in between
+    bool changed = false;
+    auto handler = [&data, &opts, &changed](sdbusplus::message_t& msg) {
+        try
+        {
+            std::string interface;
+            std::map<std::string, WatchValue> properties;
+            msg.read(interface, properties);
+
+            std::string path = msg.get_path();
+            if (!data.paths.contains(path))
+            {
+                return;
+            }
+
+            updateWatchData(data, path, properties, opts);
+            changed = true;
+        }
+        catch (const std::exception&)
+        {
+            // Not a property type that is watched
+        }
+    };
+
+    // Subscribe under the paths the fans were found at, wherever the
+    // system's inventory and sensors are
+    const std::vector<std::pair<std::string, std::string>> subscriptions{
+        {"tach", interfaces[ifaceTypeFromMethod(data.method)]},
+        {"tach", interfaces["SensorValue"]},
+        {"inventory", interfaces["Item"]},
+        {"opstatus", interfaces["OpStatus"]}};
+
+    std::vector<std::unique_ptr<sdbusplus::bus::match_t>> matches;
+    for (const auto& [type, interface] : subscriptions)
+    {
+        auto path = commonPathPrefix(data.pathMap[type]);
+        if (!path)
+        {
+            continue;
+        }
+
+        matches.push_back(std::make_unique<sdbusplus::bus::match_t>(
+            bus,
+            sdbusplus::match_rules::propertiesChangedNamespace(*path,
+                                                               interface),
+            handler));
+    }
+
+    readWatchData(data, interfaces);
+    data.lastUpdate = std::chrono::system_clock::now();
+
+    std::vector<std::string> shown;
+    if (opts.json)
+    {
+        // Start with every value
+        auto initial = data.values;
+        for (const auto& [path, properties] : initial)
+        {
+            updateWatchData(data, path, properties, opts);
+        }
+    }
+
+    readWatchZones(data, opts);
+    auto nextZoneRead = std::chrono::steady_clock::now() + zonePollInterval;
+
+    if (!opts.json)
+    {
+        redrawWatchTable(renderWatchTable(data), shown);
+    }
+
+    while (true)
+    {
+        auto now = std::chrono::steady_clock::now();
+        if (now < nextZoneRead)
+        {
+            bus.wait(std::chrono::duration_cast<sdbusplus::SdBusDuration>(
+                nextZoneRead - now));
+        }
+
+        // Handle everything that came in before redrawing once
+        while (bus.process_discard())
+        {}
+
+        if (std::chrono::steady_clock::now() >= nextZoneRead)
+        {
+            changed = readWatchZones(data, opts) || changed;
+            nextZoneRead = std::chrono::steady_clock::now() + zonePollInterval;
+        }
+
+        if (changed && !opts.json)
+        {
+            redrawWatchTable(renderWatchTable(data), shown);
+        }
+        changed = false;
+    }
+}
+
 /**
  * @function setup the CLI object to accept all options
  */
 void initCLI(CLI::App& app, uint64_t& target, std::vector<std::string>& fanList,
-             [[maybe_unused]] DumpQuery& dq, SensorOpts& sensorOpts)
+             [[maybe_unused]] DumpQuery& dq,
+             [[maybe_unused]] LatencyOpts& latencyOpts, SensorOpts& sensorOpts,
+             WatchOpts& watchOpts)
 {
     app.set_help_flag("-h,--help", "Print this help page and exit.");
 
@@ -936,7 +1650,18 @@ void initCLI(CLI::App& app, uint64_t& target, std::vector<std::string>& fanList,
     cmdDumpQuery->add_option("-p, --properties", dq.properties,
                              "Optional list of dump file property names");
     cmdDumpQuery->add_flag("-d, --dump", dq.dump,
-                           "Force a dump before the query");
+                           "Query a fresh dump of the section instead of "
+                           "the dump file");
+
+    // Latency stats
+    strHelp = "Print the event processing latency stats";
+    auto cmdLatency = commands->add_subcommand("latency", strHelp);
+    cmdLatency->set_help_flag("-h, --help", strHelp);
+    auto optOn = cmdLatency->add_flag("--on", latencyOpts.on,
+                                      "Start collecting latency stats");
+    cmdLatency
+        ->add_flag("--off", latencyOpts.off, "Stop collecting latency stats")
+        ->excludes(optOn);
 #endif
 
     auto cmdSensors =
@@ -950,6 +1675,14 @@ void initCLI(CLI::App& app, uint64_t& target, std::vector<std::string>& fanList,
         "Only show sensors with this string in the name. Optional");
     cmdSensors->add_flag("-v, --verbose", sensorOpts.verbose,
                          "Verbose: Use sensor object path for the name");
+
+    // Watch method
+    strHelp = "Watch fan targets/tachs, present/functional states, and zone "
+              "targets/floors/ceilings as they change";
+    auto cmdWatch = commands->add_subcommand("watch", strHelp);
+    cmdWatch->set_help_flag("-h, --help", strHelp);
+    cmdWatch->add_flag("-j, --json", watchOpts.json,
+                       "Print each change as a line of JSON instead");
 }
 
 /**
@@ -961,7 +1694,9 @@ int main(int argc, char* argv[])
     uint64_t target{0U};
     std::vector<std::string> fanList;
     DumpQuery dq;
+    LatencyOpts latencyOpts;
     SensorOpts sensorOpts;
+    WatchOpts watchOpts;
 
     try
     {
@@ -971,7 +1706,8 @@ int main(int argc, char* argv[])
                      "https://github.com/openbmc/phosphor-fan-presence/tree/"
                      "master/docs/control/fanctl"};
 
-        initCLI(app, target, fanList, dq, sensorOpts);
+        initCLI(app, target, fanList, dq, latencyOpts, sensorOpts,
+                watchOpts);
 
         CLI11_PARSE(app, argc, argv);
 
@@ -1010,17 +1746,21 @@ int main(int argc, char* argv[])
 #ifdef CONTROL_USE_JSON
         else if (app.got_subcommand("query_dump"))
         {
-            if (dq.dump)
-            {
-                dumpFanControl();
-            }
-            queryDumpFile(dq);
+            queryDump(dq);
+        }
+        else if (app.got_subcommand("latency"))
+        {
+            latency(latencyOpts);
         }
 #endif
         else if (app.got_subcommand("sensors"))
         {
             displaySensors(sensorOpts);
         }
+        else if (app.got_subcommand("watch"))
+        {
+            watch(watchOpts);
+        }
     }
     catch (const std::exception& e)
     {
@@ -16,14 +16,17 @@
 #pragma once
 
 #include "../utils/flight_recorder.hpp"
+#include "../utils/latency.hpp"
 #include "../zone.hpp"
 #include "config_base.hpp"
 #include "group.hpp"
+#include "metrics.hpp"
 
 #include <nlohmann/json.hpp>
 #include <phosphor-logging/lg2.hpp>
 
 #include <algorithm>
+#include <chrono>
 #include <format>
 #include <functional>
 #include <iterator>
@@ -178,11 +181,22 @@ class ActionBase : public ConfigBase
      *
      * This is the function used by triggers to run the actions against all the
      * zones that were configured for the action to run against.
+     *
+     * The run is timed once, see recordRun().
      */
     void run()
     {
+        auto start = std::chrono::steady_clock::now();
+        bool changed = false;
+
         std::for_each(_zones.begin(), _zones.end(),
-                      [this](Zone& zone) { this->run(zone); });
+                      [this, &changed](Zone& zone) {
+                          auto changes = zone.getStateChanges();
+                          this->run(zone);
+                          changed |= (zone.getStateChanges() != changes);
+                      });
+
+        recordRun(std::chrono::steady_clock::now() - start, changed);
     }
 
     /**
@@ -214,19 +228,31 @@ class ActionBase : public ConfigBase
     /**
      * @brief Dump the action as JSON
      *
-     * For now just dump its group names
+     * Dumps its group names along with how many times it ran, how many
+     * of those runs changed a zone's target, floor, or holds versus did
+     * nothing, and the total time the runs took.
      *
      * @return json
      */
-    json dump() const
+    virtual json dump() const
     {
         json groups = json::array();
         std::for_each(_groups.begin(), _groups.end(),
                       [&groups](const auto& group) {
                           groups.push_back(group.getName());
                       });
+
+        auto runTimeUs =
+            std::chrono::duration_cast<std::chrono::microseconds>(_runTime)
+                .count();
+
         json output;
         output["groups"] = groups;
+        output["runs"] = _runs;
+        output["changed_zone"] = _changedRuns;
+        output["no_op"] = _runs - _changedRuns;
+        output["run_time_us"] = runTimeUs;
+        output["mean_run_time_us"] = (_runs != 0) ? runTimeUs / _runs : 0;
         return output;
     }
 
@@ -246,6 +272,48 @@ class ActionBase : public ConfigBase
     const std::vector<Group> _groups;
 
   private:
+    /**
+     * @brief Records a run of the action against its zones
+     *
+     * Counts the run, and if it changed any zone's state, for the debug
+     * dump, and gives the time it took to everything that tracks it: the
+     * action's total run time, the application's Metrics, and, when
+     * latency stats are enabled, the histogram under the action's unique
+     * name.
+     *
+     * @param[in] duration - How long the run took
+     * @param[in] changed - If it changed the state of any zone
+     */
+    void recordRun(std::chrono::steady_clock::duration duration, bool changed)
+    {
+        _runs++;
+        if (changed)
+        {
+            _changedRuns++;
+        }
+
+        _runTime += duration;
+        Metrics::instance().record(Activity::action, duration);
+        if (LatencyStats::enabled())
+        {
+            runLatency().record(duration);
+        }
+    }
+
+    /**
+     * @brief Returns the histogram for the action's run times,
+     *        getting it the first time it is needed.
+     */
+    LatencyHistogram& runLatency()
+    {
+        if (_runLatency == nullptr)
+        {
+            _runLatency = &LatencyStats::instance().histogram(
+                "action:" + getUniqueName());
+        }
+        return *_runLatency;
+    }
+
     /* Zones configured on the action */
     std::vector<std::reference_wrapper<Zone>> _zones;
 
@@ -253,6 +321,18 @@ class ActionBase : public ConfigBase
      * It's just the name plus _actionCount at the time of action creation. */
     std::string _uniqueName;
 
+    /* Histogram of the run times, once latency stats are enabled */
+    LatencyHistogram* _runLatency = nullptr;
+
+    /* Number of times the action ran against its zones */
+    uint64_t _runs = 0;
+
+    /* Number of runs that changed the state of a zone */
+    uint64_t _changedRuns = 0;
+
+    /* Total time spent running */
+    std::chrono::steady_clock::duration _runTime{};
+
     /* Running count of all actions */
     static inline size_t _actionCount = 0;
 };
@@ -104,6 +104,19 @@ void GetManagedObjects::setZones(
     }
 }
 
+json GetManagedObjects::dump() const
+{
+    auto output = ActionBase::dump();
+
+    auto& actions = output["actions"];
+    std::for_each(_actions.begin(), _actions.end(),
+                  [&actions](const auto& action) {
+                      actions[action->getUniqueName()] = action->dump();
+                  });
+
+    return output;
+}
+
 void GetManagedObjects::setActions(const json& jsonObj)
 {
     if (!jsonObj.contains("actions"))
@@ -100,6 +100,13 @@ class GetManagedObjects :
      */
     void setZones(std::vector<std::reference_wrapper<Zone>>& zones) override;
 
+    /**
+     * @brief Dump the action along with the actions it runs
+     *
+     * @return json
+     */
+    json dump() const override;
+
   private:
     /**
      * @brief Parse and set the list of actions
@@ -108,12 +108,14 @@ class PCIeCardFloors : public ActionBase, public ActionRegister<PCIeCardFloors>
      */
     void setEventName(const std::string& /*name*/) override {}
 
-  private:
     /**
      * @brief Runs the contents of the action when the settle timer expires.
+     *
+     * Public so it can also be run without waiting on the timer.
      */
     void execute();
 
+  private:
     /**
      * @brief Constructs the PCIeCardMetadata object to load the PCIe card
      *        JSON files.
@@ -152,6 +152,19 @@ void TimerBasedActions::setZones(
     }
 }
 
+json TimerBasedActions::dump() const
+{
+    auto output = ActionBase::dump();
+
+    auto& actions = output["actions"];
+    std::for_each(_actions.begin(), _actions.end(),
+                  [&actions](const auto& action) {
+                      actions[action->getUniqueName()] = action->dump();
+                  });
+
+    return output;
+}
+
 void TimerBasedActions::setTimerConf(const json& jsonObj)
 {
     if (!jsonObj.contains("timer"))
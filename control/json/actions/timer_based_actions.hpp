@@ -114,6 +114,13 @@ class TimerBasedActions :
     virtual void setZones(
         std::vector<std::reference_wrapper<Zone>>& zones) override;
 
+    /**
+     * @brief Dump the action along with the actions it runs
+     *
+     * @return json
+     */
+    json dump() const override;
+
   private:
     /* The timer for this action */
     Timer _timer;
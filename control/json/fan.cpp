@@ -16,6 +16,7 @@
 #include "fan.hpp"
 
 #include "sdbusplus.hpp"
+#include "utils/latency.hpp"
 
 #include <nlohmann/json.hpp>
 #include <phosphor-logging/lg2.hpp>
@@ -120,11 +121,16 @@ void Fan::setZone(const json& jsonObj)
 
 void Fan::setTarget(uint64_t target)
 {
+    static auto& latency = LatencyStats::instance().histogram("fan_set_target");
+
     if ((_target == target) || !_lockedTargets.empty())
     {
         return;
     }
 
+    // Covers the writes of all the fan's target sensors
+    LatencyTimer timer{&latency};
+
     for (const auto& sensor : _sensors)
     {
         auto value = target;
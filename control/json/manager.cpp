@@ -23,12 +23,16 @@
 #include "fan.hpp"
 #include "group.hpp"
 #include "json_config.hpp"
+#include "metrics.hpp"
 #include "power_state.hpp"
 #include "profile.hpp"
 #include "sdbusplus.hpp"
 #include "utils/flight_recorder.hpp"
+#include "utils/json_writer.hpp"
+#include "utils/latency.hpp"
 #include "zone.hpp"
 
+#include <sys/resource.h>
 #include <systemd/sd-bus.h>
 
 #include <nlohmann/json.hpp>
@@ -40,9 +44,11 @@
 #include <algorithm>
 #include <chrono>
 #include <filesystem>
+#include <fstream>
 #include <functional>
 #include <map>
 #include <memory>
+#include <set>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -105,14 +111,6 @@ void Manager::sighupHandler(sdeventplus::source::Signal&,
 void Manager::dumpDebugData(sdeventplus::source::Signal&,
                             const struct signalfd_siginfo*)
 {
-    json data;
-    FlightRecorder::instance().dump(data);
-    dumpCache(data);
-
-    std::for_each(_zones.begin(), _zones.end(), [&data](const auto& zone) {
-        data["zones"][zone.second->getName()] = zone.second->dump();
-    });
-
     std::ofstream file{Manager::dumpFile};
     if (!file)
     {
@@ -120,39 +118,151 @@ void Manager::dumpDebugData(sdeventplus::source::Signal&,
         return;
     }
 
-    file << std::setw(4) << data;
+    dump(file, {});
 }
 
-void Manager::dumpCache(json& data)
+void Manager::dump(std::ostream& out, const std::set<std::string>& sections)
 {
-    auto& objects = data["objects"];
-    for (const auto& [path, interfaces] : _objects)
+    auto maxRSS = []() {
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_maxrss;
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    auto startRSS = maxRSS();
+
+    // Stream it out a section at a time, so only the small
+    // per entry pieces are ever built as json.
+    JsonWriter writer{out};
+    writer.startObject();
+
+    if (inDump(sections, "flight_recorder"))
     {
-        auto& interfaceJSON = objects[path];
+        FlightRecorder::instance().dump(writer);
+    }
 
-        for (const auto& [interface, properties] : interfaces)
+    if (inDump(sections, "latency"))
+    {
+        LatencyStats::instance().dump(writer);
+    }
+
+    dumpCache(writer, sections);
+
+    if (inDump(sections, "zones"))
+    {
+        writer.key("zones");
+        writer.startObject();
+        for (const auto& [key, zone] : _zones)
         {
-            auto& propertyJSON = interfaceJSON[interface];
-            for (const auto& [propName, propValue] : properties)
+            writer.key(zone->getName());
+            writer.value(zone->dump());
+        }
+        writer.endObject();
+    }
+
+    // ru_maxrss is the process' high water mark, so the growth
+    // is how far this dump pushed it.
+    auto endRSS = maxRSS();
+    writer.key("dump_stats");
+    writer.startObject();
+    writer.key("duration_us");
+    writer.value(std::chrono::duration_cast<std::chrono::microseconds>(
+                     std::chrono::steady_clock::now() - start)
+                     .count());
+    writer.key("max_rss_kb");
+    writer.value(endRSS);
+    writer.key("max_rss_growth_kb");
+    writer.value(endRSS - startRSS);
+    writer.endObject();
+
+    writer.endObject();
+}
+
+void Manager::toggleLatencyStats(sdeventplus::source::Signal&,
+                                 const struct signalfd_siginfo*)
+{
+    auto enable = !LatencyStats::enabled();
+    LatencyStats::instance().setEnabled(enable);
+    FlightRecorder::instance().log(
+        "main",
+        std::format("Latency stats {}", enable ? "enabled" : "disabled"));
+}
+
+std::map<std::string, int64_t> Manager::getMetricGauges() const
+{
+    return {{"zones", _zones.size()},
+            {"events", _events.size()},
+            {"timers", _timers.size()},
+            {"signal_matches", _signals.size()},
+            {"cached_objects", _objects.size()},
+            {"cached_services", _servTree.size()},
+            {"parameters", _parameters.size()}};
+}
+
+void Manager::dumpCache(JsonWriter& writer,
+                        const std::set<std::string>& sections)
+{
+    if (inDump(sections, "objects"))
+    {
+        writer.key("objects");
+        writer.startObject();
+        for (const auto& [path, interfaces] : _objects)
+        {
+            writer.key(path);
+            writer.startObject();
+            for (const auto& [interface, properties] : interfaces)
             {
-                std::visit(
-                    [&obj = propertyJSON[propName]](auto&& val) { obj = val; },
-                    propValue);
+                writer.key(interface);
+                writer.startObject();
+                for (const auto& [propName, propValue] : properties)
+                {
+                    writer.key(propName);
+                    std::visit([&writer](auto&& val) { writer.value(val); },
+                               propValue);
+                }
+                writer.endObject();
             }
+            writer.endObject();
         }
+        writer.endObject();
     }
 
-    auto& parameters = data["parameters"];
-    for (const auto& [name, value] : _parameters)
+    if (inDump(sections, "parameters"))
     {
-        std::visit([&obj = parameters[name]](auto&& val) { obj = val; }, value);
+        writer.key("parameters");
+        writer.startObject();
+        for (const auto& [name, value] : _parameters)
+        {
+            writer.key(name);
+            std::visit([&writer](auto&& val) { writer.value(val); }, value);
+        }
+        writer.endObject();
     }
 
-    std::for_each(_events.begin(), _events.end(), [&data](const auto& event) {
-        data["events"][event.second->getName()] = event.second->dump();
-    });
+    if (inDump(sections, "events"))
+    {
+        writer.key("events");
+        writer.startObject();
+        for (const auto& [key, event] : _events)
+        {
+            writer.key(event->getName());
+            writer.value(event->dump());
+        }
+        writer.endObject();
+    }
 
-    data["services"] = _servTree;
+    if (inDump(sections, "services"))
+    {
+        writer.key("services");
+        writer.startObject();
+        for (const auto& [path, services] : _servTree)
+        {
+            writer.key(path);
+            writer.value(services);
+        }
+        writer.endObject();
+    }
 }
 
 void Manager::load()
@@ -741,6 +851,8 @@ void Manager::addGroups(const std::vector<Group>& groups)
 
 void Manager::timerExpired(TimerData& data)
 {
+    ActivityTimer activityTimer{Activity::timer};
+
     if (std::get<bool>(data.second))
     {
         addGroups(std::get<const std::vector<Group>&>(data.second));
@@ -771,12 +883,26 @@ void Manager::timerExpired(TimerData& data)
 void Manager::handleSignal(sdbusplus::message_t& msg,
                            const std::vector<SignalPkg>* pkgs)
 {
+    static auto& signalLatency =
+        LatencyStats::instance().histogram("handle_signal");
+    static auto& handlerLatency =
+        LatencyStats::instance().histogram("signal_handler");
+
+    ActivityTimer activityTimer{Activity::signal};
+    LatencyTimer signalTimer{&signalLatency};
+
     for (auto& pkg : *pkgs)
     {
         // Handle the signal callback and only run the actions if the handler
         // updated the cache for the given SignalObject
-        if (std::get<SignalHandler>(
-                pkg)(msg, std::get<SignalObject>(pkg), *this))
+        bool updated = false;
+        {
+            LatencyTimer handlerTimer{&handlerLatency};
+            updated = std::get<SignalHandler>(pkg)(
+                msg, std::get<SignalObject>(pkg), *this);
+        }
+
+        if (updated)
         {
             // Perform the actions in the handler package
             auto& actions = std::get<TriggerActions>(pkg);
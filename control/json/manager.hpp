@@ -23,6 +23,7 @@
 #include "profile.hpp"
 #include "sdbusplus.hpp"
 #include "utils/flight_recorder.hpp"
+#include "utils/json_writer.hpp"
 #include "zone.hpp"
 
 #include <nlohmann/json.hpp>
@@ -38,6 +39,8 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <ostream>
+#include <set>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -176,6 +179,35 @@ class Manager
     void dumpDebugData(sdeventplus::source::Signal&,
                        const struct signalfd_siginfo*);
 
+    /**
+     * @brief Writes the debug data as JSON, only serializing the
+     *        sections asked for.
+     *
+     * The sections are flight_recorder, latency, objects, parameters,
+     * events, services, and zones.  They are streamed out as they are
+     * walked instead of being built up in memory first.  A dump_stats
+     * section with how long the dump took and the process' peak memory
+     * is always added at the end.
+     *
+     * @param[in] out - Where to write the JSON
+     * @param[in] sections - The sections to include, where empty
+     *                       means all of them.
+     */
+    void dump(std::ostream& out, const std::set<std::string>& sections);
+
+    /**
+     * @brief Callback function to handle receiving a USR2 signal to
+     * turn collecting the event processing latencies on or off.
+     */
+    void toggleLatencyStats(sdeventplus::source::Signal&,
+                            const struct signalfd_siginfo*);
+
+    /**
+     * @brief Returns the gauges for the metrics D-Bus object, which are
+     *        the sizes of the configuration, timers, matches, and caches.
+     */
+    std::map<std::string, int64_t> getMetricGauges() const;
+
     /**
      * @brief Get the active profiles of the system where an empty list
      * represents that only configuration entries without a profile defined will
@@ -390,8 +422,8 @@ class Manager
      * @param[in] prop - Dbus object's property
      * @param[in] value - Dbus object's property value
      */
-    void setProperty(const std::string& path, const std::string& intf,
-                     const std::string& prop, PropertyVariantType value);
+    static void setProperty(const std::string& path, const std::string& intf,
+                            const std::string& prop, PropertyVariantType value);
 
     /**
      * @brief Remove an object's interface
@@ -691,11 +723,24 @@ class Manager
     void setProfiles();
 
     /**
-     * @brief Dump the _objects, _servTree, and _parameters maps to JSON
+     * @brief Dump the _objects, _servTree, _parameters, and _events
+     *        maps to JSON
      *
-     * @param[out] data - The JSON that will be filled in
+     * @param[in] writer - The JSON writer
+     * @param[in] sections - The sections to include, where empty
+     *                       means all of them.
+     */
+    void dumpCache(JsonWriter& writer, const std::set<std::string>& sections);
+
+    /**
+     * @brief Returns if a section is in the sections asked for in a
+     *        dump, where no sections means all of them.
      */
-    void dumpCache(json& data);
+    static bool inDump(const std::set<std::string>& sections,
+                       const std::string& section)
+    {
+        return sections.empty() || sections.contains(section);
+    }
 
     /**
      * @brief Add a list of groups to the cache dataset.
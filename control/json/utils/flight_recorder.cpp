@@ -48,7 +48,7 @@ void FlightRecorder::log(const std::string& id, const std::string& message)
     }
 }
 
-void FlightRecorder::dump(json& data)
+void FlightRecorder::dump(JsonWriter& writer)
 {
     using namespace std::chrono;
     using Timepoint = time_point<system_clock, microseconds>;
@@ -83,15 +83,17 @@ void FlightRecorder::dump(json& data)
         return ss.str();
     };
 
-    auto& fr = data["flight_recorder"];
+    writer.key("flight_recorder");
+    writer.startArray();
     std::stringstream ss;
 
     for (const auto& [ts, id, msg] : output)
     {
         ss << formatTime(ts) << ": " << std::setw(idSize) << id << ": " << msg;
-        fr.push_back(ss.str());
+        writer.value(ss.str());
         ss.str("");
     }
+    writer.endArray();
 }
 
 } // namespace phosphor::fan::control::json
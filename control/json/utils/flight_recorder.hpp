@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 #pragma once
+#include "json_writer.hpp"
+
 #include <nlohmann/json.hpp>
 
 #include <chrono>
@@ -64,13 +66,14 @@ class FlightRecorder
     void log(const std::string& id, const std::string& message);
 
     /**
-     * @brief Writes the flight recorder contents to JSON.
+     * @brief Writes the flight recorder contents as the
+     *        "flight_recorder" array of the current JSON object.
      *
      * Sorts all messages by timestamp when doing so.
      *
-     * @param[out] data - Filled in with the flight recorder data
+     * @param[in] writer - The JSON writer
      */
-    void dump(json& data);
+    void dump(JsonWriter& writer);
 
   private:
     FlightRecorder() = default;
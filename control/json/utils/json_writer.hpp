@@ -0,0 +1,194 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+namespace phosphor::fan::control::json
+{
+using json = nlohmann::json;
+
+/**
+ * @class JsonWriter
+ *
+ * Writes JSON to a stream as it goes, in the same layout as
+ * 'out << std::setw(4) << data', so a large document like the debug
+ * dump never has to be built in memory first.  Objects and arrays are
+ * opened and closed with the start/end functions, and the values put
+ * in them are either written directly or, for small subtrees, dumped
+ * from a json object.
+ *
+ * For example:
+ *   writer.startObject();
+ *   writer.key("zones");
+ *   writer.startObject();
+ *   writer.key(name);
+ *   writer.value(zone.dump());
+ *   writer.endObject();
+ *   writer.endObject();
+ */
+class JsonWriter
+{
+  public:
+    JsonWriter() = delete;
+    ~JsonWriter() = default;
+    JsonWriter(const JsonWriter&) = delete;
+    JsonWriter& operator=(const JsonWriter&) = delete;
+    JsonWriter(JsonWriter&&) = delete;
+    JsonWriter& operator=(JsonWriter&&) = delete;
+
+    /**
+     * @brief Constructor
+     *
+     * @param[in] out - The stream to write to
+     * @param[in] indent - The spaces to indent each level by
+     */
+    explicit JsonWriter(std::ostream& out, size_t indent = 4) :
+        _out(out), _indent(indent)
+    {}
+
+    /**
+     * @brief Starts an object, which must be ended with endObject()
+     */
+    void startObject()
+    {
+        startValue();
+        _out << '{';
+        _empty.push_back(true);
+    }
+
+    /**
+     * @brief Ends the current object
+     */
+    void endObject()
+    {
+        endContainer('}');
+    }
+
+    /**
+     * @brief Starts an array, which must be ended with endArray()
+     */
+    void startArray()
+    {
+        startValue();
+        _out << '[';
+        _empty.push_back(true);
+    }
+
+    /**
+     * @brief Ends the current array
+     */
+    void endArray()
+    {
+        endContainer(']');
+    }
+
+    /**
+     * @brief Writes the key of the next value in the current object
+     *
+     * @param[in] name - The key
+     */
+    void key(std::string_view name)
+    {
+        newElement();
+        _out << json(name).dump() << ": ";
+        _haveKey = true;
+    }
+
+    /**
+     * @brief Writes a value
+     *
+     * @param[in] data - The value, which can be anything that converts
+     *                   to json, including a json subtree.
+     */
+    template <typename T>
+    void value(const T& data)
+    {
+        startValue();
+
+        // Indent the subtree's lines to where it is in the document
+        for (auto c : json(data).dump(_indent))
+        {
+            _out << c;
+            if (c == '\n')
+            {
+                writeIndent();
+            }
+        }
+    }
+
+  private:
+    /**
+     * @brief Puts what has to come before a value, which is nothing
+     *        after a key, and the separator and indent in an array.
+     */
+    void startValue()
+    {
+        if (_haveKey)
+        {
+            _haveKey = false;
+        }
+        else if (!_empty.empty())
+        {
+            newElement();
+        }
+    }
+
+    /**
+     * @brief Puts the separator, if needed, and the newline and indent
+     *        before the next element of the current container.
+     */
+    void newElement()
+    {
+        if (!_empty.back())
+        {
+            _out << ',';
+        }
+        _empty.back() = false;
+        _out << '\n';
+        writeIndent();
+    }
+
+    /**
+     * @brief Closes the current container, putting the closing
+     *        character on its own line unless it was empty.
+     */
+    void endContainer(char close)
+    {
+        auto empty = _empty.back();
+        _empty.pop_back();
+        if (!empty)
+        {
+            _out << '\n';
+            writeIndent();
+        }
+        _out << close;
+    }
+
+    void writeIndent()
+    {
+        for (size_t i = 0; i < _empty.size() * _indent; i++)
+        {
+            _out << ' ';
+        }
+    }
+
+    /* The stream written to */
+    std::ostream& _out;
+
+    /* The spaces per level */
+    const size_t _indent;
+
+    /* For each open container, if nothing has been put in it yet */
+    std::vector<bool> _empty;
+
+    /* If a key was just written, so the next value goes after it */
+    bool _haveKey = false;
+};
+
+} // namespace phosphor::fan::control::json
@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#include "latency.hpp"
+
+#include <algorithm>
+
+namespace phosphor::fan::control::json
+{
+using json = nlohmann::json;
+
+void LatencyHistogram::record(Clock::duration duration)
+{
+    auto us = duration_buckets::toUs(duration);
+
+    _buckets[duration_buckets::bucket(us)]++;
+    _count++;
+    _totalUs += us;
+    _maxUs = std::max(_maxUs, us);
+}
+
+void LatencyHistogram::reset()
+{
+    _buckets.fill(0);
+    _count = 0;
+    _totalUs = 0;
+    _maxUs = 0;
+}
+
+uint64_t LatencyHistogram::percentile(double percentile) const
+{
+    auto target = static_cast<uint64_t>(percentile / 100.0 * _count);
+    uint64_t seen = 0;
+
+    for (size_t i = 0; i < numBuckets; i++)
+    {
+        seen += _buckets[i];
+        if ((seen > target) || (seen == _count))
+        {
+            // The last bucket also has everything longer
+            return (i == numBuckets - 1)
+                       ? _maxUs
+                       : std::min(duration_buckets::upperBoundUs(i), _maxUs);
+        }
+    }
+
+    return _maxUs;
+}
+
+json LatencyHistogram::dump() const
+{
+    json buckets = json::object();
+    for (size_t i = 0; i < numBuckets; i++)
+    {
+        if (_buckets[i] != 0)
+        {
+            buckets[std::to_string(duration_buckets::upperBoundUs(i))] =
+                _buckets[i];
+        }
+    }
+
+    return {{"count", _count},
+            {"mean_us", (_count != 0) ? _totalUs / _count : 0},
+            {"max_us", _maxUs},
+            {"p50_us", percentile(50)},
+            {"p90_us", percentile(90)},
+            {"p99_us", percentile(99)},
+            {"buckets_us", buckets}};
+}
+
+LatencyStats& LatencyStats::instance()
+{
+    static LatencyStats stats;
+    return stats;
+}
+
+void LatencyStats::setEnabled(bool enable)
+{
+    if (enable && !_enabled)
+    {
+        std::for_each(_histograms.begin(), _histograms.end(),
+                      [](auto& entry) { entry.second.reset(); });
+    }
+    _enabled = enable;
+}
+
+LatencyHistogram& LatencyStats::histogram(const std::string& stage)
+{
+    return _histograms[stage];
+}
+
+void LatencyStats::dump(JsonWriter& writer) const
+{
+    writer.key("latency");
+    writer.startObject();
+    writer.key("enabled");
+    writer.value(_enabled);
+
+    for (const auto& [stage, histogram] : _histograms)
+    {
+        writer.key(stage);
+        writer.value(histogram.dump());
+    }
+    writer.endObject();
+}
+
+} // namespace phosphor::fan::control::json
@@ -0,0 +1,198 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include "duration_buckets.hpp"
+#include "json_writer.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace phosphor::fan::control::json
+{
+using json = nlohmann::json;
+
+/**
+ * @class LatencyHistogram
+ *
+ * Counts how long something took in fixed buckets, where bucket N holds
+ * the durations up to 2^N microseconds, so recording is just a bit scan
+ * and an increment.  It also keeps the total and the maximum.
+ */
+class LatencyHistogram
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t numBuckets = duration_buckets::numBuckets;
+
+    LatencyHistogram() = default;
+    ~LatencyHistogram() = default;
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+    LatencyHistogram(LatencyHistogram&&) = delete;
+    LatencyHistogram& operator=(LatencyHistogram&&) = delete;
+
+    /**
+     * @brief Adds a duration to the histogram
+     *
+     * @param[in] duration - The duration
+     */
+    void record(Clock::duration duration);
+
+    /**
+     * @brief Clears out all the counts
+     */
+    void reset();
+
+    /**
+     * @brief Returns the count, mean, max, and estimated percentiles
+     *        in microseconds, along with the non-empty buckets.
+     */
+    json dump() const;
+
+  private:
+    /**
+     * @brief Returns the upper bound of the bucket that the
+     *        percentile falls in, in microseconds.
+     *
+     * @param[in] percentile - The percentile, 0-100
+     */
+    uint64_t percentile(double percentile) const;
+
+    /* The counts in each bucket */
+    std::array<uint64_t, numBuckets> _buckets{};
+
+    /* The number of durations recorded */
+    uint64_t _count = 0;
+
+    /* The sum of the durations in microseconds */
+    uint64_t _totalUs = 0;
+
+    /* The longest duration in microseconds */
+    uint64_t _maxUs = 0;
+};
+
+/**
+ * @class LatencyStats
+ *
+ * Holds the latency histograms for the stages of handling an event,
+ * from a signal being handled through the action runs and down to the
+ * fan target writes.  Collecting them is off by default and is toggled
+ * at runtime with SIGUSR2, so that when off the only cost in the hot
+ * paths is a check of a flag.
+ *
+ * The histograms are written to the "latency" section of the debug dump.
+ */
+class LatencyStats
+{
+  public:
+    ~LatencyStats() = default;
+    LatencyStats(const LatencyStats&) = delete;
+    LatencyStats& operator=(const LatencyStats&) = delete;
+    LatencyStats(LatencyStats&&) = delete;
+    LatencyStats& operator=(LatencyStats&&) = delete;
+
+    /**
+     * @brief Returns a reference to the static instance.
+     */
+    static LatencyStats& instance();
+
+    /**
+     * @brief Says if latencies are being collected
+     */
+    static bool enabled()
+    {
+        return _enabled;
+    }
+
+    /**
+     * @brief Turns collecting latencies on or off.
+     *
+     * The histograms are cleared when it is turned on, so
+     * they only cover the time since then.
+     *
+     * @param[in] enable - If it should be on
+     */
+    void setEnabled(bool enable);
+
+    /**
+     * @brief Returns the histogram for a stage, creating it
+     *        the first time.  The reference is always valid.
+     *
+     * @param[in] stage - The stage name
+     */
+    LatencyHistogram& histogram(const std::string& stage);
+
+    /**
+     * @brief Writes the histograms as the "latency" object of the
+     *        current JSON object.
+     *
+     * @param[in] writer - The JSON writer
+     */
+    void dump(JsonWriter& writer) const;
+
+  private:
+    LatencyStats() = default;
+
+    /* If latencies are being collected */
+    static inline bool _enabled = false;
+
+    /* The histograms by stage */
+    std::map<std::string, LatencyHistogram> _histograms;
+};
+
+/**
+ * @class LatencyTimer
+ *
+ * Records the time between its construction and destruction into a
+ * histogram, when latencies are being collected.  Otherwise it doesn't
+ * even read the clock.
+ */
+class LatencyTimer
+{
+  public:
+    LatencyTimer() = delete;
+    LatencyTimer(const LatencyTimer&) = delete;
+    LatencyTimer& operator=(const LatencyTimer&) = delete;
+    LatencyTimer(LatencyTimer&&) = delete;
+    LatencyTimer& operator=(LatencyTimer&&) = delete;
+
+    /**
+     * @brief Starts timing
+     *
+     * @param[in] histogram - Where to record the time, which can be
+     *                        nullptr when nothing should be recorded.
+     */
+    explicit LatencyTimer(LatencyHistogram* histogram) :
+        _histogram(LatencyStats::enabled() ? histogram : nullptr)
+    {
+        if (_histogram != nullptr)
+        {
+            _start = LatencyHistogram::Clock::now();
+        }
+    }
+
+    ~LatencyTimer()
+    {
+        if (_histogram != nullptr)
+        {
+            _histogram->record(LatencyHistogram::Clock::now() - _start);
+        }
+    }
+
+  private:
+    /* Where to record the time */
+    LatencyHistogram* _histogram;
+
+    /* When timing started */
+    LatencyHistogram::Clock::time_point _start;
+};
+
+} // namespace phosphor::fan::control::json
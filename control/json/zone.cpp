@@ -16,8 +16,10 @@
 #include "zone.hpp"
 
 #include "../utils/flight_recorder.hpp"
+#include "../utils/latency.hpp"
 #include "dbus_zone.hpp"
 #include "fan.hpp"
+#include "metrics.hpp"
 #include "sdbusplus.hpp"
 
 #include <nlohmann/json.hpp>
@@ -142,10 +144,15 @@ void Zone::addFan(std::unique_ptr<Fan> fan)
 
 void Zone::setTarget(uint64_t target)
 {
+    static auto& latency =
+        LatencyStats::instance().histogram("zone_set_target");
+
     if (_isActive)
     {
+        LatencyTimer timer{&latency};
         if (_target != target)
         {
+            _stateChanges++;
             FlightRecorder::instance().log(
                 "zone-set-target" + getName(),
                 std::format("Set target {} (from {})", target, _target));
@@ -168,6 +175,7 @@ void Zone::lockFanTarget(const std::string& fname, uint64_t target)
     if (_fans.end() != fanItr)
     {
         (*fanItr)->lockTarget(target);
+        _stateChanges++;
     }
     else
     {
@@ -187,6 +195,7 @@ void Zone::unlockFanTarget(const std::string& fname, uint64_t target)
     if (_fans.end() != fanItr)
     {
         (*fanItr)->unlockTarget(target);
+        _stateChanges++;
 
         // attempt to resume Zone target on fan
         (*fanItr)->setTarget(getTarget());
@@ -208,6 +217,7 @@ void Zone::setTargetHold(const std::string& ident, uint64_t target, bool hold)
         size_t removed = _targetHolds.erase(ident);
         if (removed)
         {
+            _stateChanges++;
             FlightRecorder::instance().log(
                 "zone-target"s + getName(),
                 std::format("{} is removing target hold", ident));
@@ -218,6 +228,7 @@ void Zone::setTargetHold(const std::string& ident, uint64_t target, bool hold)
         if (!((_targetHolds.find(ident) != _targetHolds.end()) &&
               (_targetHolds[ident] == target)))
         {
+            _stateChanges++;
             FlightRecorder::instance().log(
                 "zone-target"s + getName(),
                 std::format("{} is setting target hold to {}", ident, target));
@@ -266,6 +277,7 @@ void Zone::setFloorHold(const std::string& ident, uint64_t target, bool hold)
         size_t removed = _floorHolds.erase(ident);
         if (removed)
         {
+            _stateChanges++;
             FlightRecorder::instance().log(
                 "zone-floor"s + getName(),
                 std::format("{} is removing floor hold", ident));
@@ -276,6 +288,7 @@ void Zone::setFloorHold(const std::string& ident, uint64_t target, bool hold)
         if (!((_floorHolds.find(ident) != _floorHolds.end()) &&
               (_floorHolds[ident] == target)))
         {
+            _stateChanges++;
             FlightRecorder::instance().log(
                 "zone-floor"s + getName(),
                 std::format("{} is setting floor hold to {}", ident, target));
@@ -328,7 +341,12 @@ void Zone::setFloor(uint64_t target)
     auto pred = [](const auto& entry) { return entry.second; };
     if (std::all_of(_floorChange.begin(), _floorChange.end(), pred))
     {
-        _floor = (target > _ceiling) ? _ceiling : target;
+        auto floor = (target > _ceiling) ? _ceiling : target;
+        if (_floor != floor)
+        {
+            _stateChanges++;
+        }
+        _floor = floor;
         // Floor above target, update target to floor
         if (_target < _floor)
         {
@@ -346,6 +364,7 @@ void Zone::requestIncrease(uint64_t targetDelta)
         auto requestTarget = getRequestTargetBase();
         requestTarget = (targetDelta - _incDelta) + requestTarget;
         _incDelta = targetDelta;
+        _stateChanges++;
         // Target can not go above a current ceiling
         if (requestTarget > _ceiling)
         {
@@ -359,6 +378,8 @@ void Zone::requestIncrease(uint64_t targetDelta)
 
 void Zone::incTimerExpired()
 {
+    ActivityTimer activityTimer{Activity::timer};
+
     // Clear increase delta when timer expires allowing additional target
     // increase requests or target decreases to occur
     _incDelta = 0;
@@ -369,12 +390,18 @@ void Zone::requestDecrease(uint64_t targetDelta)
     // Only decrease the lowest target delta requested
     if (_decDelta == 0 || targetDelta < _decDelta)
     {
+        if (_decDelta != targetDelta)
+        {
+            _stateChanges++;
+        }
         _decDelta = targetDelta;
     }
 }
 
 void Zone::decTimerExpired()
 {
+    ActivityTimer activityTimer{Activity::timer};
+
     // Check all entries are set to allow a decrease
     auto pred = [](const auto& entry) { return entry.second; };
     auto decAllowed = std::all_of(_decAllowed.begin(), _decAllowed.end(), pred);
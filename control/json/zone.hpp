@@ -179,6 +179,20 @@ class Zone : public ConfigBase
         return _decDelta;
     };
 
+    /**
+     * @brief Get the number of times the zone's target, floor, holds, or
+     * requested target deltas have been changed
+     *
+     * Comparing it before and after running an action says if the action
+     * changed anything in the zone.
+     *
+     * @return - The count of state changes
+     */
+    inline auto getStateChanges() const
+    {
+        return _stateChanges;
+    }
+
     /**
      * @brief Get the manager of the zone
      *
@@ -463,6 +477,9 @@ class Zone : public ConfigBase
     /* Requested target base */
     uint64_t _requestTargetBase;
 
+    /* Count of changes to the target, floor, holds, and target deltas */
+    uint64_t _stateChanges = 0;
+
     /* Map of whether floor changes are allowed by a string identifier */
     std::map<std::string, bool> _floorChange;
 
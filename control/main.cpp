@@ -25,6 +25,8 @@
 #endif
 
 #include "dbus_paths.hpp"
+#include "dump_object.hpp"
+#include "metrics_object.hpp"
 #include "sdbusplus.hpp"
 #include "sdeventplus.hpp"
 
@@ -41,10 +43,11 @@ using namespace phosphor::fan::control;
 #ifdef CONTROL_USE_JSON
 void dumpFlightRecorder()
 {
-    nlohmann::json data;
-    phosphor::fan::control::json::FlightRecorder::instance().dump(data);
     std::ofstream file{json::Manager::dumpFile};
-    file << std::setw(4) << data;
+    json::JsonWriter writer{file};
+    writer.startObject();
+    json::FlightRecorder::instance().dump(writer);
+    writer.endObject();
 }
 #endif
 
@@ -107,6 +110,24 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
             std::bind(&json::Manager::dumpDebugData, &manager,
                       std::placeholders::_1, std::placeholders::_2));
 
+        // Enable SIGUSR2 handling to toggle collecting latency stats
+        stdplus::signal::block(SIGUSR2);
+        sdeventplus::source::Signal sigUsr2(
+            event, SIGUSR2,
+            std::bind(&json::Manager::toggleLatencyStats, &manager,
+                      std::placeholders::_1, std::placeholders::_2));
+
+        // Put the event processing metrics on D-Bus
+        phosphor::fan::MetricsObject metrics(
+            phosphor::fan::util::SDBusPlus::getBus(),
+            std::bind(&json::Manager::getMetricGauges, &manager));
+
+        // Serve section filtered dumps to fanctl
+        phosphor::fan::DumpObject dump(
+            phosphor::fan::util::SDBusPlus::getBus(),
+            std::bind(&json::Manager::dump, &manager, std::placeholders::_1,
+                      std::placeholders::_2));
+
         phosphor::fan::util::SDBusPlus::getBus().request_name(CONTROL_BUSNAME);
 #else
         Manager manager(phosphor::fan::util::SDBusPlus::getBus(), event, mode);
@@ -0,0 +1,427 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#include "count_state_target.hpp"
+#include "group.hpp"
+#include "manager.hpp"
+#include "mapped_floor.hpp"
+#include "net_target_decrease.hpp"
+#include "net_target_increase.hpp"
+#include "pcie_card_floors.hpp"
+#include "target_from_group_max.hpp"
+#include "utils/flight_recorder.hpp"
+#include "zone.hpp"
+
+#include <nlohmann/json.hpp>
+#include <sdeventplus/event.hpp>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+using namespace phosphor::fan::control::json;
+
+/*
+ * These only use the parts of fan control that work off of the Manager's
+ * object cache and the zone state, so they don't need a D-Bus connection.
+ * The zone has no fans and is never enabled, so targets aren't written
+ * anywhere and there is no zone D-Bus object.
+ */
+
+namespace
+{
+
+constexpr auto valueIntf = "xyz.openbmc_project.Sensor.Value";
+constexpr auto valueProp = "Value";
+constexpr auto functionalIntf =
+    "xyz.openbmc_project.State.Decorator.OperationalStatus";
+constexpr auto functionalProp = "Functional";
+constexpr auto powerStateIntf =
+    "xyz.openbmc_project.State.Decorator.PowerState";
+constexpr auto powerStateProp = "PowerState";
+constexpr auto powerStateOff =
+    "xyz.openbmc_project.State.Decorator.PowerState.State.Off";
+
+/**
+ * @brief Adds a group of members to the list of groups and puts
+ *        their property values in the Manager's cache.
+ *
+ * @param[in] groups - The groups to add to
+ * @param[in] name - The group name, also used in the member paths
+ * @param[in] size - The number of members
+ * @param[in] intf - The interface of the property
+ * @param[in] prop - The property name
+ * @param[in] value - Returns the property value for a member index
+ */
+void addGroup(std::vector<Group>& groups, const std::string& name, size_t size,
+              const std::string& intf, const std::string& prop,
+              const std::function<PropertyVariantType(size_t)>& value)
+{
+    json members = json::array();
+    for (size_t i = 0; i < size; i++)
+    {
+        members.push_back("/xyz/openbmc_project/bench/" + name + "/member" +
+                          std::to_string(i));
+    }
+
+    auto& group =
+        groups.emplace_back(json{{"name", name}, {"members", members}});
+    group.setInterface(intf);
+    group.setProperty(prop);
+
+    for (size_t i = 0; i < size; i++)
+    {
+        Manager::setProperty(group.getMembers()[i], intf, prop, value(i));
+    }
+}
+
+/**
+ * @brief Adds a group of temperatures spread between 30 and 50.
+ */
+void addTempGroup(std::vector<Group>& groups, const std::string& name,
+                  size_t size)
+{
+    addGroup(groups, name, size, valueIntf, valueProp, [size](size_t i) {
+        return PropertyVariantType{30.0 + 20.0 * i / size};
+    });
+}
+
+/**
+ * @brief Creates a zone that is never enabled, so doesn't need D-Bus.
+ */
+std::unique_ptr<Zone> makeZone()
+{
+    json config{{"name", "bench_zone"},
+                {"poweron_target", 10000},
+                {"default_floor", 2000},
+                {"increase_delay", 5},
+                {"decrease_interval", 30}};
+
+    return std::make_unique<Zone>(config, sdeventplus::Event::get_default(),
+                                  nullptr);
+}
+
+/**
+ * @brief Creates an action the way the ActionFactory does.
+ */
+template <typename T>
+std::unique_ptr<ActionBase> makeAction(
+    const json& config, const std::vector<Group>& groups, Zone& zone)
+{
+    std::vector<std::reference_wrapper<Zone>> zones{zone};
+    auto action = std::make_unique<T>(config, groups);
+    action->setZones(zones);
+    return action;
+}
+
+/**
+ * @brief Counts each group member read or written as an item
+ *        for a benchmark over groups of state.range(0) members.
+ */
+void setCounters(benchmark::State& state)
+{
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+/**
+ * @brief Updating cached property values, like the signal handlers do.
+ */
+static void BM_ManagerSetProperty(benchmark::State& state)
+{
+    std::vector<Group> groups;
+    addTempGroup(groups, "set_property", state.range(0));
+    const auto& members = groups.front().getMembers();
+
+    double value = 0.0;
+    for (auto _ : state)
+    {
+        for (const auto& member : members)
+        {
+            Manager::setProperty(member, valueIntf, valueProp, value);
+        }
+        value += 0.5;
+    }
+
+    setCounters(state);
+}
+BENCHMARK(BM_ManagerSetProperty)->RangeMultiplier(10)->Range(10, 10000);
+
+/**
+ * @brief Reading cached property values, like the actions do.
+ */
+static void BM_ManagerGetObjValueVariant(benchmark::State& state)
+{
+    std::vector<Group> groups;
+    addTempGroup(groups, "get_value", state.range(0));
+    const auto& members = groups.front().getMembers();
+
+    for (auto _ : state)
+    {
+        for (const auto& member : members)
+        {
+            benchmark::DoNotOptimize(
+                Manager::getObjValueVariant(member, valueIntf, valueProp));
+        }
+    }
+
+    setCounters(state);
+}
+BENCHMARK(BM_ManagerGetObjValueVariant)->RangeMultiplier(10)->Range(10, 10000);
+
+/**
+ * @brief mapped_floor with an ambient key group and a temperature
+ *        group in each of three floor tables.
+ */
+static void BM_MappedFloor(benchmark::State& state)
+{
+    auto zone = makeZone();
+    std::vector<Group> groups;
+    addTempGroup(groups, "ambient", 4);
+    addTempGroup(groups, "mapped_temps", state.range(0));
+
+    json floors = json::array();
+    for (auto key : {40, 55, 70})
+    {
+        floors.push_back(
+            {{"key", key},
+             {"floors",
+              {{{"group", "mapped_temps"},
+                {"floors",
+                 {{{"value", 35.0}, {"floor", 3000}},
+                  {{"value", 45.0}, {"floor", 4000}},
+                  {{"value", 55.0}, {"floor", 5000}}}}}}}});
+    }
+
+    auto action = makeAction<MappedFloor>(
+        {{"name", "mapped_floor"},
+         {"key_group", "ambient"},
+         {"fan_floors", floors}},
+        groups, *zone);
+
+    for (auto _ : state)
+    {
+        action->run();
+    }
+
+    setCounters(state);
+}
+BENCHMARK(BM_MappedFloor)->RangeMultiplier(10)->Range(10, 1000);
+
+/**
+ * @brief set_net_increase_target with some members over the state.
+ */
+static void BM_NetTargetIncrease(benchmark::State& state)
+{
+    auto zone = makeZone();
+    std::vector<Group> groups;
+    addTempGroup(groups, "inc_temps", state.range(0));
+
+    auto action = makeAction<NetTargetIncrease>(
+        {{"name", "set_net_increase_target"}, {"state", 45.0}, {"delta", 100}},
+        groups, *zone);
+
+    for (auto _ : state)
+    {
+        action->run();
+    }
+
+    setCounters(state);
+}
+BENCHMARK(BM_NetTargetIncrease)->RangeMultiplier(10)->Range(10, 1000);
+
+/**
+ * @brief set_net_decrease_target with all members under the state.
+ */
+static void BM_NetTargetDecrease(benchmark::State& state)
+{
+    auto zone = makeZone();
+    std::vector<Group> groups;
+    addTempGroup(groups, "dec_temps", state.range(0));
+
+    auto action = makeAction<NetTargetDecrease>(
+        {{"name", "set_net_decrease_target"}, {"state", 60.0}, {"delta", 50}},
+        groups, *zone);
+
+    for (auto _ : state)
+    {
+        action->run();
+    }
+
+    setCounters(state);
+}
+BENCHMARK(BM_NetTargetDecrease)->RangeMultiplier(10)->Range(10, 1000);
+
+/**
+ * @brief count_state_before_target where the count is never reached,
+ *        so every member is checked each run.
+ */
+static void BM_CountStateTarget(benchmark::State& state)
+{
+    auto zone = makeZone();
+    std::vector<Group> groups;
+    addGroup(groups, "functional", state.range(0), functionalIntf,
+             functionalProp,
+             [](size_t i) { return PropertyVariantType{i != 0}; });
+
+    auto action = makeAction<CountStateTarget>(
+        {{"name", "count_state_before_target"},
+         {"count", 2},
+         {"state", false},
+         {"target", 18000}},
+        groups, *zone);
+
+    for (auto _ : state)
+    {
+        action->run();
+    }
+
+    setCounters(state);
+}
+BENCHMARK(BM_CountStateTarget)->RangeMultiplier(10)->Range(10, 1000);
+
+/**
+ * @brief target_from_group_max with a value that keeps crossing
+ *        the hysteresis, so the map is searched each run.
+ */
+static void BM_TargetFromGroupMax(benchmark::State& state)
+{
+    auto zone = makeZone();
+    std::vector<Group> groups;
+    addTempGroup(groups, "max_temps", state.range(0));
+    const auto& last = groups.front().getMembers().back();
+
+    json map = json::array();
+    for (size_t i = 0; i < 10; i++)
+    {
+        map.push_back({{"value", 25.0 + 5.0 * i}, {"target", 3000 + 1000 * i}});
+    }
+
+    auto action = makeAction<TargetFromGroupMax>(
+        {{"name", "target_from_group_max"},
+         {"neg_hysteresis", 1},
+         {"pos_hysteresis", 0},
+         {"map", map}},
+        groups, *zone);
+
+    // Includes one cache update per run, which is small next to the
+    // group scan.
+    bool high = false;
+    for (auto _ : state)
+    {
+        Manager::setProperty(last, valueIntf, valueProp, high ? 70.0 : 50.0);
+        high = !high;
+
+        action->run();
+    }
+
+    setCounters(state);
+}
+BENCHMARK(BM_TargetFromGroupMax)->RangeMultiplier(10)->Range(10, 1000);
+
+/**
+ * @brief pcie_card_floors selecting the floor index.
+ *
+ * The slots are powered off, since finding the card in a powered on
+ * slot asks the mapper for the PCIeDevice objects.  It calls execute()
+ * directly instead of run() so it doesn't wait on the settle timer,
+ * and so doesn't need a zone.
+ */
+static void BM_PCIeCardFloors(benchmark::State& state)
+{
+    std::vector<Group> groups;
+    addGroup(groups, "pcie_slots", state.range(0), powerStateIntf,
+             powerStateProp,
+             [](size_t) {
+                 return PropertyVariantType{std::string{powerStateOff}};
+             });
+
+    auto action = std::make_unique<PCIeCardFloors>(
+        json{{"name", "pcie_card_floors"}, {"settle_time", 0}}, groups);
+
+    for (auto _ : state)
+    {
+        action->execute();
+    }
+
+    setCounters(state);
+}
+BENCHMARK(BM_PCIeCardFloors)->RangeMultiplier(10)->Range(10, 1000);
+
+/**
+ * @brief Setting and releasing target holds with state.range(0)
+ *        holders, which finds the highest hold each time.
+ */
+static void BM_ZoneSetTargetHold(benchmark::State& state)
+{
+    auto zone = makeZone();
+    std::vector<std::string> idents;
+    for (int64_t i = 0; i < state.range(0); i++)
+    {
+        idents.push_back("hold" + std::to_string(i));
+        zone->setTargetHold(idents.back(), 5000 + i, true);
+    }
+
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        zone->setTargetHold(idents[i], 4000, (i % 2) == 0);
+        i = (i + 1) % idents.size();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ZoneSetTargetHold)->RangeMultiplier(10)->Range(10, 1000);
+
+/**
+ * @brief Setting and releasing floor holds with state.range(0)
+ *        holders, which finds the highest hold each time.
+ */
+static void BM_ZoneSetFloorHold(benchmark::State& state)
+{
+    auto zone = makeZone();
+    std::vector<std::string> idents;
+    for (int64_t i = 0; i < state.range(0); i++)
+    {
+        idents.push_back("hold" + std::to_string(i));
+        zone->setFloorHold(idents.back(), 3000 + i, true);
+    }
+
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        zone->setFloorHold(idents[i], 2500, (i % 2) == 0);
+        i = (i + 1) % idents.size();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ZoneSetFloorHold)->RangeMultiplier(10)->Range(10, 1000);
+
+/**
+ * @brief Logging to the flight recorder from state.range(0) IDs.
+ */
+static void BM_FlightRecorderLog(benchmark::State& state)
+{
+    std::vector<std::string> ids;
+    for (int64_t i = 0; i < state.range(0); i++)
+    {
+        ids.push_back("bench_action-" + std::to_string(i));
+    }
+
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        FlightRecorder::instance().log(ids[i], "Setting new floor to 4755");
+        i = (i + 1) % ids.size();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FlightRecorderLog)->RangeMultiplier(10)->Range(10, 1000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,87 @@
+#include "json/utils/json_writer.hpp"
+
+#include <iomanip>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+using namespace phosphor::fan::control::json;
+
+TEST(JsonWriterTest, MatchesDump)
+{
+    json expected = R"(
+    {
+        "flight_recorder": ["one", "two"],
+        "objects": {
+            "/path": {
+                "intf": {"Value": 1.5, "Present": true, "Empty": ""}
+            }
+        },
+        "empty_object": {},
+        "empty_array": [],
+        "zones": {"0": {"target": 10000, "floors": [1, 2]}}
+    })"_json;
+
+    std::ostringstream out;
+    JsonWriter writer{out};
+
+    writer.startObject();
+
+    writer.key("empty_array");
+    writer.value(json::array());
+
+    writer.key("empty_object");
+    writer.startObject();
+    writer.endObject();
+
+    writer.key("flight_recorder");
+    writer.startArray();
+    writer.value("one");
+    writer.value(std::string{"two"});
+    writer.endArray();
+
+    writer.key("objects");
+    writer.startObject();
+    writer.key("/path");
+    writer.startObject();
+    writer.key("intf");
+    writer.startObject();
+    writer.key("Empty");
+    writer.value("");
+    writer.key("Present");
+    writer.value(true);
+    writer.key("Value");
+    writer.value(1.5);
+    writer.endObject();
+    writer.endObject();
+    writer.endObject();
+
+    writer.key("zones");
+    writer.startObject();
+    writer.key("0");
+    writer.value(expected["zones"]["0"]);
+    writer.endObject();
+
+    writer.endObject();
+
+    EXPECT_EQ(json::parse(out.str()), expected);
+
+    // Same layout as streaming out the whole json with setw, which
+    // sorts the keys the way they were written here
+    std::ostringstream dumped;
+    dumped << std::setw(4) << json::parse(out.str());
+    EXPECT_EQ(out.str(), dumped.str());
+}
+
+TEST(JsonWriterTest, EscapesKeys)
+{
+    std::ostringstream out;
+    JsonWriter writer{out, 2};
+
+    writer.startObject();
+    writer.key("a \"quoted\"\nkey");
+    writer.value(1);
+    writer.endObject();
+
+    EXPECT_EQ(out.str(), "{\n  \"a \\\"quoted\\\"\\nkey\": 1\n}");
+}
@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#include "recorder.hpp"
+#include "recording.hpp"
+
+#include <CLI/CLI.hpp>
+#include <sdbusplus/bus.hpp>
+#include <sdeventplus/clock.hpp>
+#include <sdeventplus/event.hpp>
+#include <sdeventplus/source/signal.hpp>
+#include <sdeventplus/utility/timer.hpp>
+#include <stdplus/signal.hpp>
+
+#include <iostream>
+
+using namespace phosphor::fan::replay;
+
+int main(int argc, char* argv[])
+{
+    CLI::App app{"Records the D-Bus signals the fan applications use"};
+
+    std::string file;
+    unsigned duration = 0;
+    app.add_option("-o,--output", file, "The recording file to write")
+        ->required();
+    app.add_option("-d,--duration", duration,
+                   "Seconds to record for, or until stopped if 0");
+
+    try
+    {
+        app.parse(argc, argv);
+    }
+    catch (const CLI::Error& e)
+    {
+        return app.exit(e);
+    }
+
+    auto event = sdeventplus::Event::get_default();
+    auto bus = sdbusplus::bus::new_default();
+    bus.attach_event(event.get(), SD_EVENT_PRIORITY_NORMAL);
+
+    RecordWriter writer{file};
+    Recorder recorder{bus, writer};
+
+    auto stop = [&event](sdeventplus::source::Signal&,
+                         const struct signalfd_siginfo*) { event.exit(0); };
+
+    stdplus::signal::block(SIGINT);
+    stdplus::signal::block(SIGTERM);
+    sdeventplus::source::Signal sigInt{event, SIGINT, stop};
+    sdeventplus::source::Signal sigTerm{event, SIGTERM, stop};
+
+    sdeventplus::utility::Timer<sdeventplus::ClockId::Monotonic> timer{
+        event, [&event](auto&) { event.exit(0); }};
+    if (duration != 0)
+    {
+        timer.restartOnce(std::chrono::seconds{duration});
+    }
+
+    // Write out what has been recorded every few seconds so a recording
+    // that is killed off isn't lost.
+    sdeventplus::utility::Timer<sdeventplus::ClockId::Monotonic> flushTimer{
+        event, [&writer](auto&) { writer.flush(); }, std::chrono::seconds{5}};
+
+    auto rc = event.loop();
+    writer.flush();
+
+    std::cout << "Recorded " << writer.count() << " signals to " << file
+              << "\n";
+
+    return rc;
+}
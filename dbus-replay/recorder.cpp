@@ -0,0 +1,214 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#include "recorder.hpp"
+
+#include <systemd/sd-bus.h>
+
+#include <phosphor-logging/lg2.hpp>
+#include <sdbusplus/exception.hpp>
+
+#include <string_view>
+
+namespace phosphor::fan::replay
+{
+
+namespace rules = sdbusplus::bus::match::rules;
+
+namespace
+{
+
+void check(int rc, const char* what)
+{
+    if (rc < 0)
+    {
+        throw sdbusplus::exception::SdBusError(-rc, what);
+    }
+}
+
+template <typename T>
+T readBasic(sd_bus_message* m, char type)
+{
+    T value{};
+    check(sd_bus_message_read_basic(m, type, &value), "read_basic");
+    return value;
+}
+
+/**
+ * @brief Reads the contents of a variant, or skips it and returns
+ *        nothing if it isn't one of the Value types.
+ *
+ * The variant is read with the sd-bus calls instead of as a Value so
+ * that properties of other types can be left out instead of ending up
+ * as a default constructed Value.
+ */
+std::optional<Value> readValue(sd_bus_message* m, std::string_view contents)
+{
+    if (contents.size() == 1)
+    {
+        switch (contents[0])
+        {
+            case 'b':
+                return readBasic<int>(m, 'b') != 0;
+            case 'y':
+                return readBasic<uint8_t>(m, 'y');
+            case 'n':
+                return readBasic<int16_t>(m, 'n');
+            case 'q':
+                return readBasic<uint16_t>(m, 'q');
+            case 'i':
+                return readBasic<int32_t>(m, 'i');
+            case 'u':
+                return readBasic<uint32_t>(m, 'u');
+            case 'x':
+                return readBasic<int64_t>(m, 'x');
+            case 't':
+                return readBasic<uint64_t>(m, 't');
+            case 'd':
+                return readBasic<double>(m, 'd');
+            case 's':
+                return std::string{readBasic<const char*>(m, 's')};
+            case 'o':
+                return sdbusplus::message::object_path{
+                    readBasic<const char*>(m, 'o')};
+        }
+    }
+    else if (contents == "as")
+    {
+        std::vector<std::string> strings;
+        check(sd_bus_message_enter_container(m, 'a', "s"), "enter");
+        while (sd_bus_message_at_end(m, false) == 0)
+        {
+            strings.emplace_back(readBasic<const char*>(m, 's'));
+        }
+        check(sd_bus_message_exit_container(m), "exit");
+        return strings;
+    }
+
+    check(sd_bus_message_skip(m, contents.data()), "skip");
+    return std::nullopt;
+}
+
+/**
+ * @brief Reads an a{sv} property map.
+ */
+PropertyMap readProperties(sd_bus_message* m)
+{
+    PropertyMap properties;
+
+    check(sd_bus_message_enter_container(m, 'a', "{sv}"), "enter");
+    while (sd_bus_message_at_end(m, false) == 0)
+    {
+        check(sd_bus_message_enter_container(m, 'e', "sv"), "enter");
+        std::string name = readBasic<const char*>(m, 's');
+
+        const char* contents = nullptr;
+        check(sd_bus_message_peek_type(m, nullptr, &contents), "peek");
+        check(sd_bus_message_enter_container(m, 'v', contents), "enter");
+        auto value = readValue(m, contents);
+        check(sd_bus_message_exit_container(m), "exit");
+        check(sd_bus_message_exit_container(m), "exit");
+
+        if (value)
+        {
+            properties.emplace(std::move(name), std::move(*value));
+        }
+    }
+    check(sd_bus_message_exit_container(m), "exit");
+
+    return properties;
+}
+
+} // namespace
+
+Recorder::Recorder(sdbusplus::bus_t& bus, RecordWriter& writer) :
+    _writer(writer), _start(std::chrono::steady_clock::now()),
+    _propertiesChangedMatch(
+        bus,
+        rules::type::signal() + rules::member("PropertiesChanged") +
+            rules::interface("org.freedesktop.DBus.Properties"),
+        [this](auto& msg) { record(msg, SignalType::propertiesChanged); }),
+    _interfacesAddedMatch(
+        bus, rules::interfacesAdded(),
+        [this](auto& msg) { record(msg, SignalType::interfacesAdded); }),
+    _interfacesRemovedMatch(
+        bus, rules::interfacesRemoved(),
+        [this](auto& msg) { record(msg, SignalType::interfacesRemoved); }),
+    _nameOwnerChangedMatch(
+        bus, rules::nameOwnerChanged(),
+        [this](auto& msg) { record(msg, SignalType::nameOwnerChanged); })
+{}
+
+void Recorder::record(sdbusplus::message_t& msg, SignalType type)
+{
+    Record record;
+    record.time = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - _start);
+    record.type = type;
+    record.sender = msg.get_sender();
+    record.path = msg.get_path();
+
+    try
+    {
+        switch (type)
+        {
+            case SignalType::propertiesChanged:
+            {
+                auto interface = msg.unpack<std::string>();
+                record.interfaces.emplace(std::move(interface),
+                                          readProperties(msg.get()));
+                break;
+            }
+            case SignalType::interfacesAdded:
+            {
+                record.object =
+                    msg.unpack<sdbusplus::message::object_path>().str;
+
+                auto m = msg.get();
+                check(sd_bus_message_enter_container(m, 'a', "{sa{sv}}"),
+                      "enter");
+                while (sd_bus_message_at_end(m, false) == 0)
+                {
+                    check(sd_bus_message_enter_container(m, 'e', "sa{sv}"),
+                          "enter");
+                    std::string interface = readBasic<const char*>(m, 's');
+                    record.interfaces.emplace(std::move(interface),
+                                              readProperties(m));
+                    check(sd_bus_message_exit_container(m), "exit");
+                }
+                check(sd_bus_message_exit_container(m), "exit");
+                break;
+            }
+            case SignalType::interfacesRemoved:
+            {
+                auto [object, interfaces] =
+                    msg.unpack<sdbusplus::message::object_path,
+                               std::vector<std::string>>();
+                record.object = object.str;
+                for (auto& interface : interfaces)
+                {
+                    record.interfaces.emplace(std::move(interface),
+                                              PropertyMap{});
+                }
+                break;
+            }
+            case SignalType::nameOwnerChanged:
+            {
+                std::tie(record.object, record.oldOwner, record.newOwner) =
+                    msg.unpack<std::string, std::string, std::string>();
+                break;
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        lg2::error("Skipping signal on {PATH} that could not be decoded: "
+                   "{ERROR}",
+                   "PATH", record.path, "ERROR", e);
+        return;
+    }
+
+    _writer.write(record);
+}
+
+} // namespace phosphor::fan::replay
@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include "recording.hpp"
+
+#include <sdbusplus/bus.hpp>
+#include <sdbusplus/bus/match.hpp>
+
+#include <chrono>
+
+namespace phosphor::fan::replay
+{
+
+/**
+ * @class Recorder
+ *
+ * Writes the PropertiesChanged, InterfacesAdded, InterfacesRemoved,
+ * and NameOwnerChanged signals on the bus to a recording as they
+ * arrive.  These are the signals the fan applications subscribe to.
+ */
+class Recorder
+{
+  public:
+    Recorder() = delete;
+    ~Recorder() = default;
+    Recorder(const Recorder&) = delete;
+    Recorder& operator=(const Recorder&) = delete;
+    Recorder(Recorder&&) = delete;
+    Recorder& operator=(Recorder&&) = delete;
+
+    /**
+     * @brief Constructor
+     *
+     * Starts recording right away.
+     *
+     * @param[in] bus - The sdbusplus bus object
+     * @param[in] writer - The RecordWriter to write to
+     */
+    Recorder(sdbusplus::bus_t& bus, RecordWriter& writer);
+
+  private:
+    /**
+     * @brief Decodes a signal into a record and writes it.
+     *
+     * Signals that can't be decoded are logged and skipped.
+     *
+     * @param[in] msg - The signal message
+     * @param[in] type - The type of signal
+     */
+    void record(sdbusplus::message_t& msg, SignalType type);
+
+    /**
+     * @brief The RecordWriter to write to
+     */
+    RecordWriter& _writer;
+
+    /**
+     * @brief When the recording started
+     */
+    std::chrono::steady_clock::time_point _start;
+
+    /**
+     * @brief The signal matches
+     */
+    sdbusplus::bus::match_t _propertiesChangedMatch;
+    sdbusplus::bus::match_t _interfacesAddedMatch;
+    sdbusplus::bus::match_t _interfacesRemovedMatch;
+    sdbusplus::bus::match_t _nameOwnerChangedMatch;
+};
+
+} // namespace phosphor::fan::replay
@@ -0,0 +1,326 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#include "recording.hpp"
+
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+namespace phosphor::fan::replay
+{
+
+constexpr char magic[] = {'P', 'F', 'D', 'R'};
+constexpr uint8_t version = 1;
+
+namespace
+{
+
+/**
+ * @brief Builds the Value alternative at index I, used to turn
+ *        the index read from the file back into a type.
+ */
+template <size_t I = 0>
+Value makeValue(size_t index)
+{
+    if constexpr (I < std::variant_size_v<Value>)
+    {
+        if (index == I)
+        {
+            return Value{std::in_place_index<I>};
+        }
+        return makeValue<I + 1>(index);
+    }
+    else
+    {
+        throw std::runtime_error{"Unknown value type in recording"};
+    }
+}
+
+} // namespace
+
+RecordWriter::RecordWriter(const std::string& file) :
+    _file(file, std::ios::binary | std::ios::trunc)
+{
+    if (!_file)
+    {
+        throw std::runtime_error{"Could not create " + file};
+    }
+
+    _file.write(magic, sizeof(magic));
+    _file.put(static_cast<char>(version));
+}
+
+void RecordWriter::write(const Record& record)
+{
+    writeVarint((record.time - _lastTime).count());
+    _lastTime = record.time;
+
+    _file.put(static_cast<char>(record.type));
+    writeString(record.sender);
+    writeString(record.path);
+    writeString(record.object);
+
+    writeVarint(record.interfaces.size());
+    for (const auto& [interface, properties] : record.interfaces)
+    {
+        writeString(interface);
+        writeVarint(properties.size());
+        for (const auto& [name, value] : properties)
+        {
+            writeString(name);
+            writeValue(value);
+        }
+    }
+
+    if (record.type == SignalType::nameOwnerChanged)
+    {
+        writeString(record.oldOwner);
+        writeString(record.newOwner);
+    }
+
+    _count++;
+}
+
+void RecordWriter::writeVarint(uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        _file.put(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    _file.put(static_cast<char>(value));
+}
+
+void RecordWriter::writeString(const std::string& str)
+{
+    auto [it, added] = _strings.try_emplace(str, _strings.size());
+    writeVarint(it->second);
+
+    if (added)
+    {
+        writeVarint(str.size());
+        _file.write(str.data(), str.size());
+    }
+}
+
+void RecordWriter::writeValue(const Value& value)
+{
+    _file.put(static_cast<char>(value.index()));
+
+    std::visit(
+        [this](const auto& v) {
+            using T = std::decay_t<decltype(v)>;
+            if constexpr (std::is_same_v<T, bool>)
+            {
+                _file.put(v ? 1 : 0);
+            }
+            else if constexpr (std::is_same_v<T, double>)
+            {
+                auto bits = std::bit_cast<uint64_t>(v);
+                for (size_t i = 0; i < sizeof(bits); i++)
+                {
+                    _file.put(static_cast<char>(bits >> (i * 8)));
+                }
+            }
+            else if constexpr (std::is_same_v<T, std::vector<std::string>>)
+            {
+                writeVarint(v.size());
+                for (const auto& str : v)
+                {
+                    writeString(str);
+                }
+            }
+            else if constexpr (std::is_same_v<T, std::string>)
+            {
+                writeString(v);
+            }
+            else if constexpr (std::is_same_v<T,
+                                              sdbusplus::message::object_path>)
+            {
+                writeString(v.str);
+            }
+            else if constexpr (std::is_signed_v<T>)
+            {
+                // Zigzag so small negative numbers stay small.
+                int64_t n = v;
+                writeVarint((static_cast<uint64_t>(n) << 1) ^
+                            static_cast<uint64_t>(n >> 63));
+            }
+            else
+            {
+                writeVarint(v);
+            }
+        },
+        value);
+}
+
+RecordReader::RecordReader(const std::string& file) :
+    _file(file, std::ios::binary)
+{
+    if (!_file)
+    {
+        throw std::runtime_error{"Could not open " + file};
+    }
+
+    char header[sizeof(magic) + 1];
+    if (!_file.read(header, sizeof(header)) ||
+        (std::memcmp(header, magic, sizeof(magic)) != 0))
+    {
+        throw std::runtime_error{file + " is not a recording"};
+    }
+
+    if (static_cast<uint8_t>(header[sizeof(magic)]) != version)
+    {
+        throw std::runtime_error{file + " has an unsupported version"};
+    }
+}
+
+std::optional<Record> RecordReader::next()
+{
+    if (_file.peek() == std::ifstream::traits_type::eof())
+    {
+        return std::nullopt;
+    }
+
+    Record record;
+    record.time = _lastTime + std::chrono::microseconds(readVarint());
+    _lastTime = record.time;
+
+    auto type = readByte();
+    if (type > static_cast<uint8_t>(SignalType::nameOwnerChanged))
+    {
+        throw std::runtime_error{"Unknown signal type in recording"};
+    }
+    record.type = static_cast<SignalType>(type);
+
+    record.sender = readString();
+    record.path = readString();
+    record.object = readString();
+
+    auto numInterfaces = readVarint();
+    for (uint64_t i = 0; i < numInterfaces; i++)
+    {
+        auto& properties = record.interfaces[readString()];
+
+        auto numProperties = readVarint();
+        for (uint64_t p = 0; p < numProperties; p++)
+        {
+            auto name = readString();
+            properties.emplace(std::move(name), readValue());
+        }
+    }
+
+    if (record.type == SignalType::nameOwnerChanged)
+    {
+        record.oldOwner = readString();
+        record.newOwner = readString();
+    }
+
+    return record;
+}
+
+uint8_t RecordReader::readByte()
+{
+    char c;
+    if (!_file.get(c))
+    {
+        throw std::runtime_error{"Recording is cut off"};
+    }
+    return static_cast<uint8_t>(c);
+}
+
+uint64_t RecordReader::readVarint()
+{
+    uint64_t value = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7)
+    {
+        auto byte = readByte();
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return value;
+        }
+    }
+
+    throw std::runtime_error{"Bad varint in recording"};
+}
+
+std::string RecordReader::readString()
+{
+    auto index = readVarint();
+    if (index < _strings.size())
+    {
+        return _strings[index];
+    }
+
+    if (index != _strings.size())
+    {
+        throw std::runtime_error{"Bad string index in recording"};
+    }
+
+    std::string str(readVarint(), '\0');
+    if (!_file.read(str.data(), str.size()))
+    {
+        throw std::runtime_error{"Recording is cut off"};
+    }
+
+    _strings.push_back(str);
+    return str;
+}
+
+Value RecordReader::readValue()
+{
+    auto value = makeValue(readByte());
+
+    std::visit(
+        [this](auto& v) {
+            using T = std::decay_t<decltype(v)>;
+            if constexpr (std::is_same_v<T, bool>)
+            {
+                v = readByte() != 0;
+            }
+            else if constexpr (std::is_same_v<T, double>)
+            {
+                uint64_t bits = 0;
+                for (size_t i = 0; i < sizeof(bits); i++)
+                {
+                    bits |= static_cast<uint64_t>(readByte()) << (i * 8);
+                }
+                v = std::bit_cast<double>(bits);
+            }
+            else if constexpr (std::is_same_v<T, std::vector<std::string>>)
+            {
+                auto size = readVarint();
+                for (uint64_t i = 0; i < size; i++)
+                {
+                    v.push_back(readString());
+                }
+            }
+            else if constexpr (std::is_same_v<T, std::string>)
+            {
+                v = readString();
+            }
+            else if constexpr (std::is_same_v<T,
+                                              sdbusplus::message::object_path>)
+            {
+                v = sdbusplus::message::object_path{readString()};
+            }
+            else if constexpr (std::is_signed_v<T>)
+            {
+                auto n = readVarint();
+                v = static_cast<T>(static_cast<int64_t>(n >> 1) ^
+                                   -static_cast<int64_t>(n & 1));
+            }
+            else
+            {
+                v = static_cast<T>(readVarint());
+            }
+        },
+        value);
+
+    return value;
+}
+
+} // namespace phosphor::fan::replay
@@ -0,0 +1,233 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include <sdbusplus/message/native_types.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace phosphor::fan::replay
+{
+
+/**
+ * @brief The property types that are recorded.  Properties of any
+ *        other type are left out of the recording.
+ */
+using Value =
+    std::variant<bool, uint8_t, int16_t, uint16_t, int32_t, uint32_t, int64_t,
+                 uint64_t, double, std::string, std::vector<std::string>,
+                 sdbusplus::message::object_path>;
+using PropertyMap = std::map<std::string, Value>;
+using InterfaceMap = std::map<std::string, PropertyMap>;
+
+/**
+ * @brief The signals that are recorded
+ */
+enum class SignalType : uint8_t
+{
+    propertiesChanged,
+    interfacesAdded,
+    interfacesRemoved,
+    nameOwnerChanged
+};
+
+/**
+ * @brief One recorded signal
+ */
+struct Record
+{
+    /**
+     * @brief When the signal arrived, from the start of the recording
+     */
+    std::chrono::microseconds time{0};
+
+    SignalType type = SignalType::propertiesChanged;
+
+    /**
+     * @brief The unique name of the sender
+     */
+    std::string sender;
+
+    /**
+     * @brief The path the signal was sent on
+     */
+    std::string path;
+
+    /**
+     * @brief The object path argument of InterfacesAdded and
+     *        InterfacesRemoved, or the name of NameOwnerChanged
+     */
+    std::string object;
+
+    /**
+     * @brief The interfaces and properties.  PropertiesChanged has the
+     *        one interface, and InterfacesRemoved has no properties.
+     */
+    InterfaceMap interfaces;
+
+    /**
+     * @brief The owners from NameOwnerChanged
+     */
+    std::string oldOwner;
+    std::string newOwner;
+
+    bool operator==(const Record&) const = default;
+};
+
+/**
+ * @class RecordWriter
+ *
+ * Writes signals to a recording file.
+ *
+ * The file starts with the 4 byte magic "PFDR" and a version byte,
+ * followed by the records:
+ *
+ *   varint - microseconds since the previous record
+ *   byte   - the SignalType
+ *   string - sender, path, object
+ *   varint - the number of interfaces, then for each of them:
+ *     string - the interface
+ *     varint - the number of properties, then for each of them:
+ *       string - the name
+ *       byte   - the Value index, followed by the value
+ *   string - old owner, new owner (NameOwnerChanged only)
+ *
+ * Integers are LEB128 varints, zigzag encoded when signed, and doubles
+ * are their 8 raw bytes.  Since the same paths, interfaces, and names
+ * show up over and over, a string is written as a varint index into a
+ * table of the strings seen so far.  An index one past the end of the
+ * table means a new string follows as a varint length and its bytes.
+ */
+class RecordWriter
+{
+  public:
+    RecordWriter() = delete;
+    ~RecordWriter() = default;
+    RecordWriter(const RecordWriter&) = delete;
+    RecordWriter& operator=(const RecordWriter&) = delete;
+    RecordWriter(RecordWriter&&) = delete;
+    RecordWriter& operator=(RecordWriter&&) = delete;
+
+    /**
+     * @brief Constructor
+     *
+     * Throws std::runtime_error if the file can't be created.
+     *
+     * @param[in] file - The file to write
+     */
+    explicit RecordWriter(const std::string& file);
+
+    /**
+     * @brief Appends a record.
+     *
+     * @param[in] record - The record, which can't be earlier than the
+     *                     previous one
+     */
+    void write(const Record& record);
+
+    /**
+     * @brief Flushes the buffered records to the file.
+     */
+    void flush()
+    {
+        _file.flush();
+    }
+
+    /**
+     * @brief Returns the number of records written
+     */
+    size_t count() const
+    {
+        return _count;
+    }
+
+  private:
+    void writeVarint(uint64_t value);
+    void writeString(const std::string& str);
+    void writeValue(const Value& value);
+
+    /**
+     * @brief The output file
+     */
+    std::ofstream _file;
+
+    /**
+     * @brief The index of each string written so far
+     */
+    std::unordered_map<std::string, uint64_t> _strings;
+
+    /**
+     * @brief The time of the previous record
+     */
+    std::chrono::microseconds _lastTime{0};
+
+    /**
+     * @brief The number of records written
+     */
+    size_t _count = 0;
+};
+
+/**
+ * @class RecordReader
+ *
+ * Reads the signals back out of a file written by RecordWriter.
+ */
+class RecordReader
+{
+  public:
+    RecordReader() = delete;
+    ~RecordReader() = default;
+    RecordReader(const RecordReader&) = delete;
+    RecordReader& operator=(const RecordReader&) = delete;
+    RecordReader(RecordReader&&) = delete;
+    RecordReader& operator=(RecordReader&&) = delete;
+
+    /**
+     * @brief Constructor
+     *
+     * Throws std::runtime_error if the file can't be opened or
+     * isn't a recording.
+     *
+     * @param[in] file - The file to read
+     */
+    explicit RecordReader(const std::string& file);
+
+    /**
+     * @brief Returns the next record, or nothing at the end of the file.
+     *
+     * Throws std::runtime_error if the file is cut off or corrupt.
+     */
+    std::optional<Record> next();
+
+  private:
+    uint8_t readByte();
+    uint64_t readVarint();
+    std::string readString();
+    Value readValue();
+
+    /**
+     * @brief The input file
+     */
+    std::ifstream _file;
+
+    /**
+     * @brief The strings seen so far, by index
+     */
+    std::vector<std::string> _strings;
+
+    /**
+     * @brief The time of the previous record
+     */
+    std::chrono::microseconds _lastTime{0};
+};
+
+} // namespace phosphor::fan::replay
@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#include "recording.hpp"
+#include "replayer.hpp"
+
+#include <CLI/CLI.hpp>
+#include <sdbusplus/bus.hpp>
+
+#include <iomanip>
+#include <iostream>
+
+using namespace phosphor::fan::replay;
+
+int main(int argc, char* argv[])
+{
+    CLI::App app{"Replays recorded D-Bus signals to a fan application and "
+                 "reports how it kept up"};
+
+    std::string file;
+    ReplayOptions options;
+    double settle = 1.0;
+
+    app.add_option("file", file, "The recording to replay")->required();
+    app.add_option("-s,--speed", options.speed,
+                   "How many times faster than recorded to replay, or as "
+                   "fast as possible if 0")
+        ->capture_default_str()
+        ->check(CLI::NonNegativeNumber);
+    app.add_option("-t,--target", options.target,
+                   "Bus name of the application under test, to measure "
+                   "how long it takes to handle the signals");
+    app.add_option("-n,--sync-every", options.syncEvery,
+                   "Signals to send between pings of the target")
+        ->capture_default_str()
+        ->check(CLI::PositiveNumber);
+    app.add_option("-w,--settle", settle,
+                   "Seconds to keep collecting fan targets after the last "
+                   "signal")
+        ->capture_default_str()
+        ->check(CLI::NonNegativeNumber);
+
+    try
+    {
+        app.parse(argc, argv);
+    }
+    catch (const CLI::Error& e)
+    {
+        return app.exit(e);
+    }
+
+    options.settle = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::duration<double>(settle));
+
+    try
+    {
+        RecordReader reader{file};
+        auto bus = sdbusplus::bus::new_default();
+
+        Replayer replayer{bus, options};
+        replayer.replay(reader);
+
+        std::cout << std::setw(4) << replayer.report() << "\n";
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
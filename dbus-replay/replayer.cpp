@@ -0,0 +1,281 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#include "replayer.hpp"
+
+#include <systemd/sd-bus.h>
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <variant>
+
+namespace phosphor::fan::replay
+{
+
+namespace rules = sdbusplus::bus::match::rules;
+using Clock = std::chrono::steady_clock;
+using json = nlohmann::json;
+
+constexpr auto propertiesInterface = "org.freedesktop.DBus.Properties";
+constexpr auto objectManagerInterface = "org.freedesktop.DBus.ObjectManager";
+constexpr auto busName = "org.freedesktop.DBus";
+
+const std::vector<std::string> targetInterfaces{
+    "xyz.openbmc_project.Control.FanSpeed",
+    "xyz.openbmc_project.Control.FanPwm"};
+
+Replayer::Replayer(sdbusplus::bus_t& bus, const ReplayOptions& options) :
+    _bus(bus), _options(options), _uniqueName(bus.get_unique_name())
+{
+    for (const auto& interface : targetInterfaces)
+    {
+        _matches.emplace_back(
+            _bus,
+            rules::type::signal() + rules::member("PropertiesChanged") +
+                rules::interface(propertiesInterface) +
+                rules::argN(0, interface),
+            [this](auto& msg) { targetChanged(msg); });
+    }
+}
+
+void Replayer::replay(RecordReader& reader)
+{
+    auto start = Clock::now();
+    std::optional<std::chrono::microseconds> firstTime;
+
+    while (auto record = reader.next())
+    {
+        _records++;
+
+        if (!firstTime)
+        {
+            firstTime = record->time;
+        }
+
+        // Also handles what came in since the previous signal when
+        // going as fast as possible.
+        auto due = start;
+        if (_options.speed > 0.0)
+        {
+            due += std::chrono::duration_cast<Clock::duration>(
+                (record->time - *firstTime) / _options.speed);
+        }
+        processUntil(due);
+
+        if (!send(*record))
+        {
+            _skipped++;
+            continue;
+        }
+
+        _sent++;
+        _unsynced.push_back(Clock::now());
+
+        if (!_options.target.empty() &&
+            (_unsynced.size() >= _options.syncEvery))
+        {
+            sync();
+        }
+    }
+
+    if (!_options.target.empty() && !_unsynced.empty())
+    {
+        sync();
+    }
+    sd_bus_flush(_bus.get());
+
+    _duration = Clock::now() - start;
+
+    processUntil(Clock::now() + _options.settle);
+}
+
+bool Replayer::send(const Record& record)
+{
+    try
+    {
+        switch (record.type)
+        {
+            case SignalType::propertiesChanged:
+            {
+                if (record.interfaces.empty())
+                {
+                    return false;
+                }
+
+                const auto& [interface, properties] =
+                    *record.interfaces.begin();
+                auto msg = _bus.new_signal(record.path.c_str(),
+                                           propertiesInterface,
+                                           "PropertiesChanged");
+                msg.append(interface, properties, std::vector<std::string>{});
+                msg.signal_send();
+                break;
+            }
+            case SignalType::interfacesAdded:
+            {
+                auto msg = _bus.new_signal(record.path.c_str(),
+                                           objectManagerInterface,
+                                           "InterfacesAdded");
+                msg.append(sdbusplus::message::object_path{record.object},
+                           record.interfaces);
+                msg.signal_send();
+                break;
+            }
+            case SignalType::interfacesRemoved:
+            {
+                std::vector<std::string> interfaces;
+                for (const auto& [interface, _] : record.interfaces)
+                {
+                    interfaces.push_back(interface);
+                }
+
+                auto msg = _bus.new_signal(record.path.c_str(),
+                                           objectManagerInterface,
+                                           "InterfacesRemoved");
+                msg.append(sdbusplus::message::object_path{record.object},
+                           interfaces);
+                msg.signal_send();
+                break;
+            }
+            case SignalType::nameOwnerChanged:
+                return changeOwner(record);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        lg2::error("Could not replay signal on {PATH}: {ERROR}", "PATH",
+                   record.path, "ERROR", e);
+        return false;
+    }
+
+    return true;
+}
+
+bool Replayer::changeOwner(const Record& record)
+{
+    const auto& name = record.object;
+    if (name.starts_with(':') || (name == busName))
+    {
+        return false;
+    }
+
+    if (!record.oldOwner.empty() && _names.contains(name))
+    {
+        sd_bus_release_name(_bus.get(), name.c_str());
+        _names.erase(name);
+    }
+
+    if (!record.newOwner.empty() && !_names.contains(name))
+    {
+        _bus.request_name(name.c_str());
+        _names.insert(name);
+    }
+
+    return true;
+}
+
+void Replayer::sync()
+{
+    try
+    {
+        auto msg = _bus.new_method_call(_options.target.c_str(), "/",
+                                        "org.freedesktop.DBus.Peer", "Ping");
+        _bus.call(msg);
+    }
+    catch (const std::exception& e)
+    {
+        // Without a reply the latency isn't known.
+        lg2::error("Could not ping {TARGET}: {ERROR}", "TARGET",
+                   _options.target, "ERROR", e);
+        _unsynced.clear();
+        return;
+    }
+
+    auto now = Clock::now();
+    for (const auto& sent : _unsynced)
+    {
+        _latencies.push_back(
+            std::chrono::duration_cast<std::chrono::microseconds>(now - sent)
+                .count());
+    }
+    _unsynced.clear();
+}
+
+void Replayer::processUntil(Clock::time_point until)
+{
+    while (_bus.process_discard())
+    {}
+
+    for (auto now = Clock::now(); now < until; now = Clock::now())
+    {
+        _bus.wait(std::chrono::duration_cast<sdbusplus::SdBusDuration>(
+            until - now));
+        while (_bus.process_discard())
+        {}
+    }
+}
+
+void Replayer::targetChanged(sdbusplus::message_t& msg)
+{
+    if (msg.get_sender() == _uniqueName)
+    {
+        return;
+    }
+
+    auto [interface, properties] =
+        msg.unpack<std::string,
+                   std::map<std::string, std::variant<uint64_t>>>();
+
+    auto target = properties.find("Target");
+    if (target == properties.end())
+    {
+        return;
+    }
+
+    auto& fan = _targets[msg.get_path()];
+    fan.target = std::get<uint64_t>(target->second);
+    fan.changes++;
+}
+
+json Replayer::report() const
+{
+    json report;
+    auto seconds = std::chrono::duration<double>(_duration).count();
+
+    report["records"] = _records;
+    report["sent"] = _sent;
+    report["skipped"] = _skipped;
+    report["duration_s"] = seconds;
+    report["signals_per_s"] = (seconds > 0.0) ? (_sent / seconds) : 0.0;
+
+    if (!_latencies.empty())
+    {
+        auto sorted = _latencies;
+        std::sort(sorted.begin(), sorted.end());
+
+        auto percentile = [&sorted](size_t p) {
+            return sorted[std::min(sorted.size() - 1, sorted.size() * p / 100)];
+        };
+
+        report["latency_us"] = {
+            {"count", sorted.size()},
+            {"mean", std::accumulate(sorted.begin(), sorted.end(), 0.0) /
+                         sorted.size()},
+            {"p50", percentile(50)},
+            {"p90", percentile(90)},
+            {"p99", percentile(99)},
+            {"max", sorted.back()}};
+    }
+
+    auto& targets = report["fan_targets"] = json::object();
+    for (const auto& [path, fan] : _targets)
+    {
+        targets[path] = {{"target", fan.target}, {"changes", fan.changes}};
+    }
+
+    return report;
+}
+
+} // namespace phosphor::fan::replay
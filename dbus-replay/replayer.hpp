@@ -0,0 +1,201 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include "recording.hpp"
+
+#include <nlohmann/json.hpp>
+#include <sdbusplus/bus.hpp>
+#include <sdbusplus/bus/match.hpp>
+
+#include <chrono>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace phosphor::fan::replay
+{
+
+/**
+ * @brief How to replay a recording
+ */
+struct ReplayOptions
+{
+    /**
+     * @brief How many times faster than recorded to send the signals,
+     *        where 0 sends them as fast as possible.
+     */
+    double speed = 1.0;
+
+    /**
+     * @brief The bus name of the application under test.  When set, it
+     *        is pinged to find out when it has handled the signals.
+     */
+    std::string target;
+
+    /**
+     * @brief How many signals to send between pings of the target
+     */
+    size_t syncEvery = 1;
+
+    /**
+     * @brief How long to keep collecting fan targets after the last
+     *        signal is sent
+     */
+    std::chrono::milliseconds settle{1000};
+};
+
+/**
+ * @class Replayer
+ *
+ * Sends the signals in a recording back out on a bus, normally a
+ * private one that the application under test has been pointed at.
+ *
+ * PropertiesChanged, InterfacesAdded, and InterfacesRemoved are sent
+ * as recorded, but from the replayer's own connection.  Since only the
+ * bus can send NameOwnerChanged, it is reproduced by the replayer
+ * taking or releasing the well known name, which has the bus send it.
+ * NameOwnerChanged for unique names can't be reproduced and is skipped.
+ *
+ * If there is a target, the latency of each signal is from when it is
+ * sent until the target answers a ping sent after it.  Since the bus
+ * keeps the messages between two connections in order, that is when
+ * the target has finished handling the signal.  The fan targets in the
+ * report are from the Target PropertiesChanged signals that the fans
+ * send when the application under test changes them.
+ */
+class Replayer
+{
+  public:
+    Replayer() = delete;
+    ~Replayer() = default;
+    Replayer(const Replayer&) = delete;
+    Replayer& operator=(const Replayer&) = delete;
+    Replayer(Replayer&&) = delete;
+    Replayer& operator=(Replayer&&) = delete;
+
+    /**
+     * @brief Constructor
+     *
+     * @param[in] bus - The sdbusplus bus object
+     * @param[in] options - How to replay
+     */
+    Replayer(sdbusplus::bus_t& bus, const ReplayOptions& options);
+
+    /**
+     * @brief Sends all of the signals in the recording.
+     *
+     * @param[in] reader - The recording
+     */
+    void replay(RecordReader& reader);
+
+    /**
+     * @brief Returns the throughput, the latency, and the fan targets.
+     */
+    nlohmann::json report() const;
+
+  private:
+    /**
+     * @brief The last target seen for a fan
+     */
+    struct FanTarget
+    {
+        uint64_t target;
+        size_t changes;
+    };
+
+    /**
+     * @brief Sends the signal for a record.
+     *
+     * @param[in] record - The record
+     *
+     * @return bool - If it was sent or skipped
+     */
+    bool send(const Record& record);
+
+    /**
+     * @brief Reproduces NameOwnerChanged by taking or releasing the name.
+     *
+     * @param[in] record - The NameOwnerChanged record
+     *
+     * @return bool - If the owner was changed or skipped
+     */
+    bool changeOwner(const Record& record);
+
+    /**
+     * @brief Pings the target and records the latency of the signals
+     *        sent since the previous ping.
+     */
+    void sync();
+
+    /**
+     * @brief Handles incoming messages until the time passed in.
+     *
+     * @param[in] until - When to return
+     */
+    void processUntil(std::chrono::steady_clock::time_point until);
+
+    /**
+     * @brief The PropertiesChanged handler for the fan target interfaces.
+     *
+     * @param[in] msg - The signal message
+     */
+    void targetChanged(sdbusplus::message_t& msg);
+
+    /**
+     * @brief The sdbusplus bus object
+     */
+    sdbusplus::bus_t& _bus;
+
+    /**
+     * @brief How to replay
+     */
+    ReplayOptions _options;
+
+    /**
+     * @brief The replayer's unique name, to ignore its own signals
+     */
+    std::string _uniqueName;
+
+    /**
+     * @brief The well known names taken for NameOwnerChanged
+     */
+    std::set<std::string> _names;
+
+    /**
+     * @brief The number of records read, sent, and skipped
+     */
+    size_t _records = 0;
+    size_t _sent = 0;
+    size_t _skipped = 0;
+
+    /**
+     * @brief How long it took to send the signals and, with a target,
+     *        for it to handle them
+     */
+    std::chrono::steady_clock::duration _duration{0};
+
+    /**
+     * @brief When each signal since the previous ping was sent
+     */
+    std::vector<std::chrono::steady_clock::time_point> _unsynced;
+
+    /**
+     * @brief The latency of each signal, in microseconds
+     */
+    std::vector<uint64_t> _latencies;
+
+    /**
+     * @brief The fan targets, by path
+     */
+    std::map<std::string, FanTarget> _targets;
+
+    /**
+     * @brief The fan target matches
+     */
+    std::vector<sdbusplus::bus::match_t> _matches;
+};
+
+} // namespace phosphor::fan::replay
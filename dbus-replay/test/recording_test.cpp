@@ -0,0 +1,171 @@
+#include "../recording.hpp"
+
+#include <unistd.h>
+
+#include <filesystem>
+#include <limits>
+
+#include <gtest/gtest.h>
+
+using namespace phosphor::fan::replay;
+using namespace std::chrono_literals;
+
+class RecordingTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        file = std::filesystem::temp_directory_path() /
+               ("recording_test." + std::to_string(getpid()));
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(file);
+    }
+
+    std::string file;
+};
+
+TEST_F(RecordingTest, RoundTripTest)
+{
+    std::vector<Record> records;
+
+    records.push_back({1500us,
+                       SignalType::propertiesChanged,
+                       ":1.40",
+                       "/xyz/openbmc_project/sensors/temperature/inlet",
+                       "",
+                       {{"xyz.openbmc_project.Sensor.Value",
+                         {{"Value", 27.125}}}},
+                       "",
+                       ""});
+
+    records.push_back(
+        {1500us,
+         SignalType::interfacesAdded,
+         ":1.41",
+         "/xyz/openbmc_project/inventory",
+         "/xyz/openbmc_project/inventory/system/chassis/fan0",
+         {{"xyz.openbmc_project.Inventory.Item",
+           {{"Present", true}, {"PrettyName", std::string{"fan0"}}}},
+          {"xyz.openbmc_project.Test",
+           {{"Byte", uint8_t{200}},
+            {"Int16", int16_t{-300}},
+            {"UInt16", uint16_t{60000}},
+            {"Int32", std::numeric_limits<int32_t>::min()},
+            {"UInt32", uint32_t{7}},
+            {"Int64", int64_t{-1}},
+            {"UInt64", std::numeric_limits<uint64_t>::max()},
+            {"Double", -0.5},
+            {"Strings", std::vector<std::string>{"a", "", "fan0"}},
+            {"Path", sdbusplus::message::object_path{"/a/b"}}}}},
+         "",
+         ""});
+
+    records.push_back({2s,
+                       SignalType::interfacesRemoved,
+                       ":1.41",
+                       "/xyz/openbmc_project/inventory",
+                       "/xyz/openbmc_project/inventory/system/chassis/fan0",
+                       {{"xyz.openbmc_project.Inventory.Item", {}}},
+                       "",
+                       ""});
+
+    records.push_back({5min,
+                       SignalType::nameOwnerChanged,
+                       "org.freedesktop.DBus",
+                       "/org/freedesktop/DBus",
+                       "xyz.openbmc_project.Hwmon-1.Hwmon1",
+                       {},
+                       ":1.40",
+                       ""});
+
+    {
+        RecordWriter writer{file};
+        for (const auto& record : records)
+        {
+            writer.write(record);
+        }
+        EXPECT_EQ(writer.count(), records.size());
+    }
+
+    RecordReader reader{file};
+    for (const auto& record : records)
+    {
+        auto read = reader.next();
+        ASSERT_TRUE(read);
+        EXPECT_EQ(*read, record);
+    }
+    EXPECT_FALSE(reader.next());
+}
+
+TEST_F(RecordingTest, StringTableTest)
+{
+    Record record{0us,
+                  SignalType::propertiesChanged,
+                  ":1.40",
+                  "/xyz/openbmc_project/sensors/fan_tach/fan0_0",
+                  "",
+                  {{"xyz.openbmc_project.Sensor.Value", {{"Value", 5000.0}}}},
+                  "",
+                  ""};
+
+    {
+        RecordWriter writer{file};
+        writer.write(record);
+    }
+    auto oneRecord = std::filesystem::file_size(file);
+
+    {
+        RecordWriter writer{file};
+        for (int i = 0; i < 100; i++)
+        {
+            record.time = i * 1s;
+            writer.write(record);
+        }
+    }
+
+    // After the first one, each record only needs the time, the type,
+    // the string indexes, and the value.
+    auto size = std::filesystem::file_size(file);
+    EXPECT_LT(size, oneRecord + 99 * 24);
+
+    RecordReader reader{file};
+    for (int i = 0; i < 100; i++)
+    {
+        auto read = reader.next();
+        ASSERT_TRUE(read);
+        EXPECT_EQ(read->time, i * 1s);
+        EXPECT_EQ(read->path, record.path);
+    }
+    EXPECT_FALSE(reader.next());
+}
+
+TEST_F(RecordingTest, BadFileTest)
+{
+    EXPECT_THROW(RecordReader{"/this/does/not/exist"}, std::runtime_error);
+
+    {
+        std::ofstream out{file};
+        out << "not a recording";
+    }
+    EXPECT_THROW(RecordReader{file}, std::runtime_error);
+
+    // Cut off partway through a record
+    {
+        RecordWriter writer{file};
+        writer.write({0us,
+                      SignalType::propertiesChanged,
+                      ":1.40",
+                      "/path",
+                      "",
+                      {{"xyz.openbmc_project.Sensor.Value", {{"Value", 1.0}}}},
+                      "",
+                      ""});
+    }
+    std::filesystem::resize_file(file, std::filesystem::file_size(file) - 3);
+
+    RecordReader reader{file};
+    EXPECT_THROW(reader.next(), std::runtime_error);
+}
@@ -17,3 +17,15 @@ static constexpr char THERMAL_ALERT_BUSNAME[] =
 // Thermal Application's root D-Bus object path
 static constexpr char THERMAL_ALERT_OBJPATH[] =
     "/xyz/openbmc_project/alerts/thermal_fault_alert";
+
+// Path of the metrics object hosted by each fan application
+static constexpr char METRICS_OBJPATH[] = "/xyz/openbmc_project/fan/metrics";
+
+// Interface of the metrics object
+static constexpr char METRICS_INTERFACE[] = "xyz.openbmc_project.Fan.Metrics";
+
+// Path of the dump object hosted by fan control
+static constexpr char DUMP_OBJPATH[] = "/xyz/openbmc_project/fan/dump";
+
+// Interface of the dump object
+static constexpr char DUMP_INTERFACE[] = "xyz.openbmc_project.Fan.Dump";
@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#include "dump_object.hpp"
+
+#include "dbus_paths.hpp"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <format>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+#include <vector>
+
+namespace phosphor::fan
+{
+
+constexpr auto internalFailure =
+    "xyz.openbmc_project.Common.Error.InternalFailure";
+
+const sdbusplus::vtable_t DumpObject::_vtable[] = {
+    sdbusplus::vtable::start(),
+    sdbusplus::vtable::method("Dump", "as", "h", dump),
+    sdbusplus::vtable::end()};
+
+DumpObject::DumpObject(sdbusplus::bus_t& bus, DumpFunc dump) :
+    _dump(std::move(dump)),
+    _interface(bus, DUMP_OBJPATH, DUMP_INTERFACE, _vtable, this)
+{}
+
+int DumpObject::dump(sd_bus_message* msg, void* context, sd_bus_error* error)
+{
+    auto self = static_cast<DumpObject*>(context);
+    int fd = -1;
+
+    try
+    {
+        std::vector<std::string> names;
+        sdbusplus::message_t{msg}.read(names);
+        std::set<std::string> sections{names.begin(), names.end()};
+
+        fd = memfd_create("fan_dump", MFD_CLOEXEC);
+        if (fd < 0)
+        {
+            throw std::system_error{errno, std::generic_category(),
+                                    "memfd_create"};
+        }
+
+        // Opening it through /proc gives the stream its own file offset,
+        // so the fd sent back is still at the start.
+        std::ofstream file{std::format("/proc/self/fd/{}", fd)};
+        if (!file)
+        {
+            throw std::runtime_error{"Could not open the dump memfd"};
+        }
+
+        self->_dump(file, sections);
+
+        file.close();
+        if (!file)
+        {
+            throw std::runtime_error{"Could not write the dump"};
+        }
+    }
+    catch (const std::exception& e)
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+        return sd_bus_error_set(error, internalFailure, e.what());
+    }
+
+    // The reply gets its own copy of the fd
+    auto rc = sd_bus_reply_method_return(msg, "h", fd);
+    close(fd);
+    return rc;
+}
+
+} // namespace phosphor::fan
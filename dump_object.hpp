@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include <systemd/sd-bus.h>
+
+#include <sdbusplus/bus.hpp>
+#include <sdbusplus/server/interface.hpp>
+#include <sdbusplus/vtable.hpp>
+
+#include <functional>
+#include <ostream>
+#include <set>
+#include <string>
+
+namespace phosphor::fan
+{
+
+/**
+ * @class DumpObject
+ *
+ * Puts a Dump(as sections) -> h method on D-Bus at DUMP_OBJPATH on the
+ * DUMP_INTERFACE interface, so a client can get an application's debug
+ * dump without signaling it and polling for a file.
+ *
+ * The dump is written into a memfd before the method returns, and the
+ * reply has a file descriptor to it positioned at the start.  So the
+ * client never sees a partial dump and the application never waits on
+ * the client reading it.  Only the sections asked for are serialized,
+ * with none meaning all of them.
+ */
+class DumpObject
+{
+  public:
+    using DumpFunc = std::function<void(std::ostream&,
+                                        const std::set<std::string>&)>;
+
+    DumpObject() = delete;
+    ~DumpObject() = default;
+    DumpObject(const DumpObject&) = delete;
+    DumpObject& operator=(const DumpObject&) = delete;
+    DumpObject(DumpObject&&) = delete;
+    DumpObject& operator=(DumpObject&&) = delete;
+
+    /**
+     * @brief Constructor
+     *
+     * @param[in] bus - The sdbusplus bus object
+     * @param[in] dump - Writes the dump of the sections passed in
+     */
+    DumpObject(sdbusplus::bus_t& bus, DumpFunc dump);
+
+  private:
+    static int dump(sd_bus_message* msg, void* context, sd_bus_error* error);
+
+    static const sdbusplus::vtable_t _vtable[];
+
+    /* Writes the dump */
+    DumpFunc _dump;
+
+    /* The interface on D-Bus */
+    sdbusplus::server::interface_t _interface;
+};
+
+} // namespace phosphor::fan
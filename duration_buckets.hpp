@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace phosphor::fan::duration_buckets
+{
+
+/* Bucket N is for durations <= 2^N us, with the last one
+ * (~8.4s) also taking anything longer. */
+constexpr size_t numBuckets = 24;
+
+/**
+ * @brief Returns a duration in whole microseconds, where a negative
+ *        one, which a clock that isn't steady could give, is 0.
+ *
+ * @param[in] duration - The duration
+ */
+template <typename Rep, typename Period>
+constexpr uint64_t toUs(std::chrono::duration<Rep, Period> duration)
+{
+    return static_cast<uint64_t>(std::max<int64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(duration)
+            .count(),
+        0));
+}
+
+/**
+ * @brief Returns the bucket a duration in microseconds goes in
+ *
+ * @param[in] us - The duration in microseconds
+ */
+constexpr size_t bucket(uint64_t us)
+{
+    // The smallest N where us <= 2^N
+    size_t n = (us <= 1) ? 0 : std::bit_width(us - 1);
+    return std::min(n, numBuckets - 1);
+}
+
+/**
+ * @brief Returns the upper bound of a bucket in microseconds,
+ *        ignoring that the last one also takes anything longer.
+ *
+ * @param[in] bucket - The bucket
+ */
+constexpr uint64_t upperBoundUs(size_t bucket)
+{
+    return uint64_t{1} << bucket;
+}
+
+} // namespace phosphor::fan::duration_buckets
@@ -106,6 +106,21 @@ class EvDev
         return std::make_tuple(ev.type, ev.code, ev.value);
     }
 
+    /**
+     * @brief Get the next event without blocking if the device was
+     *        opened with O_NONBLOCK.
+     *
+     * @param[in] flags - The libevdev read flags
+     * @param[out] ev - The event
+     *
+     * @return The libevdev_next_event return code, which is -EAGAIN
+     *         when there are no more events.
+     */
+    int nextEvent(unsigned int flags, struct input_event& ev)
+    {
+        return libevdev_next_event(evdev.get(), flags, &ev);
+    }
+
   private:
     EvDevPtr get()
     {
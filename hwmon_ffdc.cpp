@@ -1,12 +1,22 @@
 #include "hwmon_ffdc.hpp"
 
 #include "logging.hpp"
+#include "utility.hpp"
 
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
 #include <array>
+#include <cerrno>
+#include <charconv>
+#include <deque>
 #include <filesystem>
 #include <format>
 #include <fstream>
+#include <iterator>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace phosphor::fan::monitor
@@ -17,28 +27,11 @@ namespace util
 
 namespace fs = std::filesystem;
 
-inline std::vector<std::string> executeCommand(const std::string& command)
-{
-    std::vector<std::string> output;
-    std::array<char, 128> buffer;
-
-    auto pipe_close = [](auto fd) { (void)pclose(fd); };
-
-    std::unique_ptr<FILE, decltype(pipe_close)> pipe(
-        popen(command.c_str(), "r"), pipe_close);
-    if (!pipe)
-    {
-        getLogger().log(
-            std::format("popen() failed when running command: {}", command));
-        return output;
-    }
-    while (fgets(buffer.data(), buffer.size(), pipe.get()) != nullptr)
-    {
-        output.emplace_back(buffer.data());
-    }
-
-    return output;
-}
+/**
+ * @brief The most matching kernel messages to keep.  The newest
+ *        ones are kept, as they are the ones near the error.
+ */
+constexpr size_t maxKmsgLines = 100;
 
 std::vector<std::string> getHwmonNameFFDC()
 {
@@ -83,34 +76,97 @@ std::vector<std::string> getHwmonNameFFDC()
     return hwmonNames;
 }
 
-std::vector<std::string> getDmesgFFDC()
+std::vector<std::string> getDmesgFFDC(const std::vector<std::string>& names)
 {
-    std::vector<std::string> output;
-    auto dmesgOutput = executeCommand("dmesg");
+    std::deque<std::string> output;
+
+    // Read the kernel ring buffer directly instead of running dmesg.
+    // Non-blocking so the read stops with EAGAIN at the end of the
+    // buffer instead of waiting for new messages.
+    phosphor::fan::util::FileDescriptor fd{
+        open("/dev/kmsg", O_RDONLY | O_NONBLOCK | O_CLOEXEC)};
+    if (fd() == -1)
+    {
+        auto e = errno;
+        getLogger().log(std::format("Could not open /dev/kmsg, errno {}", e));
+        return {};
+    }
 
-    // Only pull in dmesg lines with interesting keywords.
-    // One example is:
+    // Only pull in lines with interesting keywords or that
+    // mention a loaded hwmon driver.  One example is:
     // [   16.390603] max31785: probe of 7-0052 failed with error -110
     // using ' probe' to avoid 'modprobe'
-    std::vector<std::string> matches{" probe", "failed"};
+    std::vector<std::string_view> matches{" probe", "failed"};
+    matches.insert(matches.end(), names.begin(), names.end());
 
-    for (const auto& line : dmesgOutput)
+    // Each read returns one record, which the kernel limits to 8KB
+    std::array<char, 8192> buffer;
+
+    while (true)
     {
-        for (const auto& m : matches)
+        auto rc = read(fd(), buffer.data(), buffer.size());
+        if (rc < 0)
         {
-            if (line.find(m) != std::string::npos)
+            // EPIPE means the record was overwritten while reading,
+            // and the next read gets the next one.  EAGAIN is the end
+            // of the buffer.  EINVAL, a record that didn't fit, stops
+            // too since the kernel doesn't move past that record and
+            // reading again would just fail on it forever.
+            if (errno == EPIPE)
             {
-                output.push_back(line);
-                if (output.back().back() == '\n')
-                {
-                    output.back().pop_back();
-                }
-                break;
+                continue;
             }
+            break;
+        }
+        if (rc == 0)
+        {
+            break;
+        }
+
+        // The record is "prio,seq,usec,flags[,...];message\n" and may
+        // have continuation lines after the message.
+        std::string_view record{buffer.data(), static_cast<size_t>(rc)};
+        auto semi = record.find(';');
+        if (semi == std::string_view::npos)
+        {
+            continue;
+        }
+
+        auto message = record.substr(semi + 1);
+        message = message.substr(0, message.find('\n'));
+
+        auto matched =
+            std::any_of(matches.begin(), matches.end(), [message](auto m) {
+                return !m.empty() && (message.find(m) != std::string::npos);
+            });
+        if (!matched)
+        {
+            continue;
+        }
+
+        // Format the timestamp like dmesg does
+        uint64_t usec = 0;
+        auto header = record.substr(0, semi);
+        auto first = header.find(',');
+        auto second = header.find(',', first + 1);
+        if ((first != std::string_view::npos) &&
+            (second != std::string_view::npos))
+        {
+            auto third = header.find(',', second + 1);
+            auto field = header.substr(second + 1, third - second - 1);
+            std::from_chars(field.data(), field.data() + field.size(), usec);
+        }
+
+        output.push_back(std::format("[{:5}.{:06}] {}", usec / 1000000,
+                                     usec % 1000000, message));
+        if (output.size() > maxKmsgLines)
+        {
+            output.pop_front();
         }
     }
 
-    return output;
+    return {std::make_move_iterator(output.begin()),
+            std::make_move_iterator(output.end())};
 }
 
 } // namespace util
@@ -120,12 +176,13 @@ nlohmann::json collectHwmonFFDC()
     nlohmann::json ffdc;
 
     auto hwmonNames = util::getHwmonNameFFDC();
+
+    auto dmesg = util::getDmesgFFDC(hwmonNames);
     if (!hwmonNames.empty())
     {
         ffdc["hwmonNames"] = std::move(hwmonNames);
     }
 
-    auto dmesg = util::getDmesgFFDC();
     if (!dmesg.empty())
     {
         ffdc["dmesg"] = std::move(dmesg);
@@ -7,8 +7,9 @@ namespace phosphor::fan::monitor
 /**
  * @brief Collects hwmon data for event log FFDC
  *
- * Makes a list of the loaded hwmon driver names, and
- * pulls interesting lines from dmesg.
+ * Makes a list of the loaded hwmon driver names, and pulls
+ * interesting lines, including ones that mention those drivers,
+ * from the kernel ring buffer in /dev/kmsg.
  *
  * @return json - The FFDC data
  */
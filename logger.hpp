@@ -7,14 +7,18 @@
 #include <nlohmann/json.hpp>
 #include <phosphor-logging/lg2.hpp>
 
+#include <array>
 #include <cassert>
+#include <chrono>
 #include <ctime>
 #include <filesystem>
 #include <format>
 #include <fstream>
 #include <iomanip>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <tuple>
 #include <vector>
 
 namespace phosphor::fan
@@ -23,16 +27,21 @@ namespace phosphor::fan
 /**
  * @class Logger
  *
- * A simple logging class that stores log messages in a vector along
- * with their timestamp.  When a messaged is logged, it will also be
- * written to the journal.
+ * A simple logging class that stores log messages in a ring buffer
+ * along with their timestamp.  When a messaged is logged, it will also
+ * be written to the journal.
+ *
+ * The entries are kept as the raw time and the message, and are only
+ * formatted when they are read out with getLogs() or saveToTempFile(),
+ * so logging a message doesn't allocate or format anything beyond what
+ * the caller passes in.
  *
  * A saveToTempFile() function will write the log entries as JSON to
  * a temporary file, so they can be added to event logs.
  *
  * The maximum number of entries to keep is specified in the
  * constructor, and after that is hit the oldest entry will be
- * removed when a new one is added.
+ * overwritten when a new one is added.
  */
 class Logger
 {
@@ -60,7 +69,7 @@ class Logger
      * @param[in] maxEntries - The maximum number of log entries
      *                         to keep.
      */
-    explicit Logger(size_t maxEntries) : _maxEntries(maxEntries)
+    explicit Logger(size_t maxEntries) : _entries(maxEntries)
     {
         assert(maxEntries != 0);
     }
@@ -68,11 +77,11 @@ class Logger
     /**
      * @brief Places an entry in the log and writes it to the journal.
      *
-     * @param[in] message - The log message
+     * @param[in] message - The log message, which is moved in
      *
      * @param[in] priority - The priority for the journal
      */
-    void log(const std::string& message, Priority priority = Logger::info)
+    void log(std::string message, Priority priority = Logger::info)
     {
         if (priority == Logger::error)
         {
@@ -83,21 +92,18 @@ class Logger
             lg2::info("{MSG}", "MSG", message);
         }
 
-        if (_entries.size() == _maxEntries)
+        auto& entry = _entries[(_first + _size) % _entries.size()];
+        entry.time = std::chrono::system_clock::now();
+        entry.message = std::move(message);
+
+        if (_size == _entries.size())
         {
-            _entries.erase(_entries.begin());
+            _first = (_first + 1) % _entries.size();
+        }
+        else
+        {
+            _size++;
         }
-
-        // Generate a timestamp
-        auto t = std::time(nullptr);
-        auto tm = *std::localtime(&t);
-
-        // e.g. Sep 22 19:56:32
-        auto timestamp = std::put_time(&tm, "%b %d %H:%M:%S");
-
-        std::ostringstream stream;
-        stream << timestamp;
-        _entries.emplace_back(stream.str(), message);
     }
 
     /**
@@ -107,7 +113,13 @@ class Logger
      */
     const nlohmann::json getLogs() const
     {
-        return _entries;
+        auto logs = nlohmann::json::array();
+        for (size_t i = 0; i < _size; i++)
+        {
+            const auto& entry = at(i);
+            logs.push_back(LogEntry{formatTime(entry.time), entry.message});
+        }
+        return logs;
     }
 
     /**
@@ -133,9 +145,11 @@ class Logger
 
         std::filesystem::path path{tmpFile};
 
-        for (const auto& [time, message] : _entries)
+        for (size_t i = 0; i < _size; i++)
         {
-            auto line = std::format("{}: {}\n", time, message);
+            const auto& entry = at(i);
+            auto line = std::format("{}: {}\n", formatTime(entry.time),
+                                    entry.message);
             auto rc = write(fd(), line.data(), line.size());
             if (rc == -1)
             {
@@ -155,19 +169,58 @@ class Logger
      */
     void clear()
     {
-        _entries.clear();
+        _first = 0;
+        _size = 0;
     }
 
   private:
     /**
-     * @brief The maximum number of entries to hold
+     * @brief A log entry as it is stored
+     */
+    struct Entry
+    {
+        std::chrono::system_clock::time_point time;
+        std::string message;
+    };
+
+    /**
+     * @brief Returns the entry at an index, where 0 is the oldest
+     */
+    const Entry& at(size_t index) const
+    {
+        return _entries[(_first + index) % _entries.size()];
+    }
+
+    /**
+     * @brief Formats a timestamp, e.g. Sep 22 19:56:32
+     */
+    static std::string formatTime(std::chrono::system_clock::time_point time)
+    {
+        auto t = std::chrono::system_clock::to_time_t(time);
+        std::tm tm{};
+        localtime_r(&t, &tm);
+
+        std::array<char, 32> timestamp{};
+        std::strftime(timestamp.data(), timestamp.size(), "%b %d %H:%M:%S",
+                      &tm);
+        return timestamp.data();
+    }
+
+    /**
+     * @brief The ring buffer of entries, sized to the maximum
+     *        number to hold
+     */
+    std::vector<Entry> _entries;
+
+    /**
+     * @brief The index of the oldest entry
      */
-    const size_t _maxEntries;
+    size_t _first = 0;
 
     /**
-     * @brief The vector of <timestamp, message> entries
+     * @brief The number of entries held
      */
-    std::vector<LogEntry> _entries;
+    size_t _size = 0;
 };
 
 } // namespace phosphor::fan
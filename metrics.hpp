@@ -0,0 +1,205 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include "duration_buckets.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <string_view>
+#include <vector>
+
+namespace phosphor::fan
+{
+
+/**
+ * @brief The kinds of work an application does that are counted and
+ *        timed by Metrics.
+ */
+enum class Activity
+{
+    signal,
+    action,
+    dbusCall,
+    timer
+};
+
+/**
+ * @class Metrics
+ *
+ * Always on counters and duration histograms of the work the fan
+ * applications do: D-Bus signals handled, actions run, D-Bus method
+ * calls made, and timer wakeups.  They are fixed arrays indexed by
+ * Activity, so recording is a few relaxed atomic adds with no lookups
+ * or allocations, and they can be read at any time by MetricsObject
+ * without serializing anything else.
+ *
+ * The atomics are because D-Bus calls can also be made from worker
+ * threads.
+ */
+class Metrics
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t numBuckets = duration_buckets::numBuckets;
+
+    static constexpr size_t numActivities = 4;
+
+    /**
+     * @brief A snapshot of the metrics of one activity
+     */
+    struct Snapshot
+    {
+        uint64_t count = 0;
+        uint64_t errors = 0;
+        uint64_t totalUs = 0;
+        uint64_t maxUs = 0;
+        std::vector<uint64_t> buckets;
+    };
+
+    ~Metrics() = default;
+    Metrics(const Metrics&) = delete;
+    Metrics& operator=(const Metrics&) = delete;
+    Metrics(Metrics&&) = delete;
+    Metrics& operator=(Metrics&&) = delete;
+
+    /**
+     * @brief Returns a reference to the static instance.
+     */
+    static Metrics& instance()
+    {
+        static Metrics metrics;
+        return metrics;
+    }
+
+    /**
+     * @brief Returns the name an activity is reported under
+     */
+    static constexpr std::string_view name(Activity activity)
+    {
+        constexpr std::array<std::string_view, numActivities> names{
+            "signals", "actions", "dbus_calls", "timers"};
+        return names[static_cast<size_t>(activity)];
+    }
+
+    /**
+     * @brief Counts one instance of an activity and how long it took.
+     *
+     * @param[in] activity - The activity
+     * @param[in] duration - How long it took
+     * @param[in] failed - If it failed, to also count an error
+     */
+    void record(Activity activity, Clock::duration duration,
+                bool failed = false)
+    {
+        auto& stats = _stats[static_cast<size_t>(activity)];
+        auto us = duration_buckets::toUs(duration);
+
+        stats.buckets[duration_buckets::bucket(us)].fetch_add(
+            1, std::memory_order_relaxed);
+        stats.count.fetch_add(1, std::memory_order_relaxed);
+        stats.totalUs.fetch_add(us, std::memory_order_relaxed);
+        if (failed)
+        {
+            stats.errors.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        auto max = stats.maxUs.load(std::memory_order_relaxed);
+        while ((us > max) && !stats.maxUs.compare_exchange_weak(
+                                 max, us, std::memory_order_relaxed))
+        {}
+    }
+
+    /**
+     * @brief Returns the current metrics of an activity
+     *
+     * @param[in] activity - The activity
+     */
+    Snapshot snapshot(Activity activity) const
+    {
+        const auto& stats = _stats[static_cast<size_t>(activity)];
+        Snapshot snapshot{stats.count.load(std::memory_order_relaxed),
+                          stats.errors.load(std::memory_order_relaxed),
+                          stats.totalUs.load(std::memory_order_relaxed),
+                          stats.maxUs.load(std::memory_order_relaxed),
+                          {}};
+
+        snapshot.buckets.reserve(numBuckets);
+        for (const auto& bucket : stats.buckets)
+        {
+            snapshot.buckets.push_back(
+                bucket.load(std::memory_order_relaxed));
+        }
+
+        return snapshot;
+    }
+
+  private:
+    Metrics() = default;
+
+    /**
+     * @brief The counts and histogram of one activity
+     */
+    struct Stats
+    {
+        std::array<std::atomic<uint64_t>, numBuckets> buckets{};
+        std::atomic<uint64_t> count = 0;
+        std::atomic<uint64_t> errors = 0;
+        std::atomic<uint64_t> totalUs = 0;
+        std::atomic<uint64_t> maxUs = 0;
+    };
+
+    /* The stats, indexed by Activity */
+    std::array<Stats, numActivities> _stats{};
+};
+
+/**
+ * @class ActivityTimer
+ *
+ * Records an activity and the time between its construction and
+ * destruction in Metrics.  It is counted as an error when it is
+ * destroyed because of an exception.
+ */
+class ActivityTimer
+{
+  public:
+    ActivityTimer() = delete;
+    ActivityTimer(const ActivityTimer&) = delete;
+    ActivityTimer& operator=(const ActivityTimer&) = delete;
+    ActivityTimer(ActivityTimer&&) = delete;
+    ActivityTimer& operator=(ActivityTimer&&) = delete;
+
+    /**
+     * @brief Starts timing
+     *
+     * @param[in] activity - The activity being timed
+     */
+    explicit ActivityTimer(Activity activity) :
+        _activity(activity), _exceptions(std::uncaught_exceptions()),
+        _start(Metrics::Clock::now())
+    {}
+
+    ~ActivityTimer()
+    {
+        Metrics::instance().record(
+            _activity, Metrics::Clock::now() - _start,
+            std::uncaught_exceptions() > _exceptions);
+    }
+
+  private:
+    /* The activity being timed */
+    const Activity _activity;
+
+    /* The number of exceptions in flight when it started */
+    const int _exceptions;
+
+    /* When timing started */
+    const Metrics::Clock::time_point _start;
+};
+
+} // namespace phosphor::fan
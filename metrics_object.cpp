@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#include "metrics_object.hpp"
+
+#include "dbus_paths.hpp"
+#include "metrics.hpp"
+
+#include <array>
+#include <tuple>
+#include <vector>
+
+namespace phosphor::fan
+{
+
+constexpr auto internalFailure =
+    "xyz.openbmc_project.Common.Error.InternalFailure";
+
+constexpr std::array activities{Activity::signal, Activity::action,
+                                Activity::dbusCall, Activity::timer};
+static_assert(activities.size() == Metrics::numActivities);
+
+const sdbusplus::vtable_t MetricsObject::_vtable[] = {
+    sdbusplus::vtable::start(),
+    sdbusplus::vtable::property("Counters", "a{st}", getCounters),
+    sdbusplus::vtable::property("Histograms", "a{s(tttat)}", getHistograms),
+    sdbusplus::vtable::property("Gauges", "a{sx}", getGauges),
+    sdbusplus::vtable::end()};
+
+MetricsObject::MetricsObject(sdbusplus::bus_t& bus, GaugeFunc gauges) :
+    _gauges(std::move(gauges)),
+    _interface(bus, METRICS_OBJPATH, METRICS_INTERFACE, _vtable, this)
+{}
+
+int MetricsObject::getCounters(sd_bus*, const char*, const char*,
+                               const char*, sd_bus_message* reply, void*,
+                               sd_bus_error* error)
+{
+    try
+    {
+        std::map<std::string, uint64_t> counters;
+        for (auto activity : activities)
+        {
+            auto name = std::string{Metrics::name(activity)};
+            auto snapshot = Metrics::instance().snapshot(activity);
+            counters[name] = snapshot.count;
+            counters[name + "_errors"] = snapshot.errors;
+        }
+
+        sdbusplus::message_t msg{reply};
+        msg.append(counters);
+    }
+    catch (const std::exception& e)
+    {
+        return sd_bus_error_set(error, internalFailure, e.what());
+    }
+
+    return 1;
+}
+
+int MetricsObject::getHistograms(sd_bus*, const char*, const char*,
+                                 const char*, sd_bus_message* reply, void*,
+                                 sd_bus_error* error)
+{
+    try
+    {
+        std::map<std::string, std::tuple<uint64_t, uint64_t, uint64_t,
+                                         std::vector<uint64_t>>>
+            histograms;
+        for (auto activity : activities)
+        {
+            auto snapshot = Metrics::instance().snapshot(activity);
+            histograms.emplace(
+                Metrics::name(activity),
+                std::make_tuple(snapshot.count, snapshot.totalUs,
+                                snapshot.maxUs, std::move(snapshot.buckets)));
+        }
+
+        sdbusplus::message_t msg{reply};
+        msg.append(histograms);
+    }
+    catch (const std::exception& e)
+    {
+        return sd_bus_error_set(error, internalFailure, e.what());
+    }
+
+    return 1;
+}
+
+int MetricsObject::getGauges(sd_bus*, const char*, const char*, const char*,
+                             sd_bus_message* reply, void* context,
+                             sd_bus_error* error)
+{
+    auto self = static_cast<MetricsObject*>(context);
+
+    try
+    {
+        sdbusplus::message_t msg{reply};
+        msg.append(self->_gauges());
+    }
+    catch (const std::exception& e)
+    {
+        return sd_bus_error_set(error, internalFailure, e.what());
+    }
+
+    return 1;
+}
+
+} // namespace phosphor::fan
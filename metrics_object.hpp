@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include <systemd/sd-bus.h>
+
+#include <sdbusplus/bus.hpp>
+#include <sdbusplus/server/interface.hpp>
+#include <sdbusplus/vtable.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+
+namespace phosphor::fan
+{
+
+/**
+ * @class MetricsObject
+ *
+ * Puts the Metrics of an application on D-Bus at METRICS_OBJPATH,
+ * so that they can be sampled often and cheaply instead of with a full
+ * debug dump.  The METRICS_INTERFACE interface has the read only
+ * properties:
+ *
+ *  - Counters (a{st}) - For each activity, the number of times it was
+ *    done, along with '<activity>_errors' for the number that failed.
+ *  - Histograms (a{s(tttat)}) - For each activity, the count, total
+ *    microseconds, max microseconds, and the counts in each bucket,
+ *    where bucket N is for durations <= 2^N microseconds.
+ *  - Gauges (a{sx}) - Current values from the application, like how
+ *    many objects it has cached.
+ *
+ * The values are read when the properties are, and PropertiesChanged
+ * is never emitted for them.
+ */
+class MetricsObject
+{
+  public:
+    using GaugeFunc = std::function<std::map<std::string, int64_t>()>;
+
+    MetricsObject() = delete;
+    ~MetricsObject() = default;
+    MetricsObject(const MetricsObject&) = delete;
+    MetricsObject& operator=(const MetricsObject&) = delete;
+    MetricsObject(MetricsObject&&) = delete;
+    MetricsObject& operator=(MetricsObject&&) = delete;
+
+    /**
+     * @brief Constructor
+     *
+     * @param[in] bus - The sdbusplus bus object
+     * @param[in] gauges - Returns the application's gauges
+     */
+    MetricsObject(sdbusplus::bus_t& bus, GaugeFunc gauges);
+
+  private:
+    /**
+     * @brief The property getters
+     */
+    static int getCounters(sd_bus* bus, const char* path,
+                           const char* interface, const char* property,
+                           sd_bus_message* reply, void* context,
+                           sd_bus_error* error);
+
+    static int getHistograms(sd_bus* bus, const char* path,
+                             const char* interface, const char* property,
+                             sd_bus_message* reply, void* context,
+                             sd_bus_error* error);
+
+    static int getGauges(sd_bus* bus, const char* path, const char* interface,
+                         const char* property, sd_bus_message* reply,
+                         void* context, sd_bus_error* error);
+
+    static const sdbusplus::vtable_t _vtable[];
+
+    /* Returns the gauges */
+    GaugeFunc _gauges;
+
+    /* The interface on D-Bus */
+    sdbusplus::server::interface_t _interface;
+};
+
+} // namespace phosphor::fan
@@ -0,0 +1,231 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace phosphor::fan::monitor
+{
+
+/**
+ * @brief The configuration of a DegradationDetector
+ */
+struct DegradationConfig
+{
+    // The EWMA weight of each new sample, between 0 and 1
+    double lambda;
+
+    // How many baseline standard deviations the EWMA has to drop
+    // by to be considered a significant drift
+    double sigmaLimit;
+
+    // The number of samples used to learn the baseline
+    size_t learningSamples;
+
+    // The smallest drift, in percent of the baseline, that will be
+    // flagged regardless of how quiet the baseline was
+    double minDriftPercent;
+
+    // The number of samples to skip after a target change while
+    // the rotor settles to the new speed
+    size_t settleSamples;
+};
+
+/**
+ * @class DegradationDetector
+ *
+ * Detects a slow downward drift in the ratio of a rotor's actual speed
+ * to the speed it is expected to run at for its target, well before
+ * the rotor falls far enough out of range to be set nonfunctional.
+ *
+ * The first learningSamples ratios establish the baseline mean and
+ * standard deviation of that rotor.  After that, each ratio updates an
+ * exponentially weighted moving average (an EWMA control chart), and a
+ * predicted failure is flagged when the average drops below the
+ * baseline by more than sigmaLimit standard deviations of the EWMA
+ * statistic, or by minDriftPercent, whichever is larger.
+ *
+ * Each update is a constant number of floating point operations.
+ */
+class DegradationDetector
+{
+  public:
+    DegradationDetector() = delete;
+    ~DegradationDetector() = default;
+    DegradationDetector(const DegradationDetector&) = default;
+    DegradationDetector& operator=(const DegradationDetector&) = default;
+    DegradationDetector(DegradationDetector&&) = default;
+    DegradationDetector& operator=(DegradationDetector&&) = default;
+
+    /**
+     * @brief Constructor
+     *
+     * @param[in] config - The detector configuration
+     */
+    explicit DegradationDetector(const DegradationConfig& config) :
+        _config(config)
+    {}
+
+    /**
+     * @brief Adds a sample
+     *
+     * @param[in] ratio - The actual/expected speed ratio
+     *
+     * @return bool - true only on the sample that first
+     *                flags a predicted failure
+     */
+    bool update(double ratio)
+    {
+        if (_learned < _config.learningSamples)
+        {
+            _learned++;
+            auto delta = ratio - _baseline;
+            _baseline += delta / static_cast<double>(_learned);
+            _m2 += delta * (ratio - _baseline);
+
+            if (_learned == _config.learningSamples)
+            {
+                auto sigma =
+                    (_learned > 1)
+                        ? std::sqrt(_m2 / static_cast<double>(_learned - 1))
+                        : 0.0;
+                auto ewmaSigma = sigma * std::sqrt(_config.lambda /
+                                                   (2.0 - _config.lambda));
+
+                _limit = _baseline -
+                         std::max(_config.sigmaLimit * ewmaSigma,
+                                  _baseline * _config.minDriftPercent / 100.0);
+                _ewma = _baseline;
+            }
+            return false;
+        }
+
+        _ewma = _config.lambda * ratio + (1.0 - _config.lambda) * _ewma;
+
+        if (!_predictedFailure && (_ewma < _limit))
+        {
+            _predictedFailure = true;
+            return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Returns true once the baseline has been learned
+     */
+    bool learned() const
+    {
+        return _learned >= _config.learningSamples;
+    }
+
+    /**
+     * @brief Returns true if a predicted failure has been flagged
+     */
+    bool predictedFailure() const
+    {
+        return _predictedFailure;
+    }
+
+    /**
+     * @brief Returns the baseline ratio (the running mean while learning)
+     */
+    double baseline() const
+    {
+        return _baseline;
+    }
+
+    /**
+     * @brief Returns the current EWMA of the ratio
+     */
+    double ewma() const
+    {
+        return _ewma;
+    }
+
+    /**
+     * @brief Returns the EWMA value below which a failure is predicted
+     */
+    double limit() const
+    {
+        return _limit;
+    }
+
+    /**
+     * @brief Returns the configuration
+     */
+    const DegradationConfig& config() const
+    {
+        return _config;
+    }
+
+    /**
+     * @brief Starts over with learning a new baseline, such as
+     *        after the fan has been replaced.
+     */
+    void reset()
+    {
+        _learned = 0;
+        _baseline = 0.0;
+        _m2 = 0.0;
+        _ewma = 0.0;
+        _limit = 0.0;
+        _predictedFailure = false;
+    }
+
+  private:
+    /**
+     * @brief The configuration
+     */
+    DegradationConfig _config;
+
+    /**
+     * @brief The number of baseline samples learned so far
+     */
+    size_t _learned = 0;
+
+    /**
+     * @brief The baseline mean ratio
+     */
+    double _baseline = 0.0;
+
+    /**
+     * @brief Running sum of squared differences from the baseline
+     */
+    double _m2 = 0.0;
+
+    /**
+     * @brief The exponentially weighted moving average of the ratio
+     */
+    double _ewma = 0.0;
+
+    /**
+     * @brief The lower control limit for _ewma
+     */
+    double _limit = 0.0;
+
+    /**
+     * @brief If a predicted failure was flagged
+     */
+    bool _predictedFailure = false;
+};
+
+/**
+ * @brief Converts a DegradationDetector's state to JSON for FFDC
+ *        and debug dumps.
+ */
+inline void to_json(nlohmann::json& j, const DegradationDetector& detector)
+{
+    j = nlohmann::json{{"learned", detector.learned()},
+                       {"baseline", detector.baseline()},
+                       {"ewma", detector.ewma()},
+                       {"limit", detector.limit()},
+                       {"predicted_failure", detector.predictedFailure()}};
+}
+
+} // namespace phosphor::fan::monitor
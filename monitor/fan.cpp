@@ -16,6 +16,7 @@
 #include "fan.hpp"
 
 #include "logging.hpp"
+#include "metrics.hpp"
 #include "sdbusplus.hpp"
 #include "types.hpp"
 #include "utility.hpp"
@@ -69,7 +70,8 @@ void Fan::init()
             _mode, _bus, *this, s.name, s.hasTarget, _def.funcDelay,
             s.targetInterface, s.targetPath, s.factor, s.offset, _def.method,
             s.threshold, s.ignoreAboveMax, _def.timeout,
-            _def.nonfuncRotorErrDelay, _def.countInterval, _event));
+            _def.nonfuncRotorErrDelay, _def.countInterval,
+            _def.tachHistoryDepth, _def.degradation, _event));
 
         _trustManager->registerSensor(_sensors.back());
     }
@@ -110,8 +112,10 @@ void Fan::init()
     {
         _fanMissingErrorTimer = std::make_unique<
             sdeventplus::utility::Timer<sdeventplus::ClockId::Monotonic>>(
-            _event, std::bind(&ZoneBase::fanMissingErrorTimerExpired, &_system,
-                              std::ref(*this)));
+            _event, [this](auto&) {
+                ActivityTimer activityTimer{Activity::timer};
+                _system.fanMissingErrorTimerExpired(*this);
+            });
     }
 
     try
@@ -141,6 +145,8 @@ void Fan::init()
 
 void Fan::presenceIfaceAdded(sdbusplus::message_t& msg)
 {
+    ActivityTimer activityTimer{Activity::signal};
+
     sdbusplus::object_path path;
     std::map<std::string, std::map<std::string, std::variant<bool>>> interfaces;
 
@@ -177,6 +183,8 @@ void Fan::presenceIfaceAdded(sdbusplus::message_t& msg)
 
 void Fan::startMonitor()
 {
+    ActivityTimer activityTimer{Activity::timer};
+
     _monitorReady = true;
 
     std::for_each(_sensors.begin(), _sensors.end(), [this](auto& sensor) {
@@ -244,6 +252,14 @@ void Fan::tachChanged(TachSensor& sensor)
         }
     }
 
+    // Only feed in-range samples to the predictive failure detection,
+    // as out of range sensors are already handled by the method below.
+    if (_present && sensor.functional() && !outOfRange(sensor) &&
+        sensor.updateDegradation())
+    {
+        _system.sensorDegradationDetected(*this, sensor);
+    }
+
     // If the error checking method is 'count', if a tach change leads
     // to an out of range sensor the count timer will take over in calling
     // process() until the sensor is healthy again.
@@ -255,6 +271,8 @@ void Fan::tachChanged(TachSensor& sensor)
 
 void Fan::countTimerExpired(TachSensor& sensor)
 {
+    ActivityTimer activityTimer{Activity::timer};
+
     if (_trustManager->active() && !_trustManager->checkTrust(sensor))
     {
         return;
@@ -458,6 +476,8 @@ bool Fan::updateInventory(bool functional)
 
 void Fan::presenceChanged(sdbusplus::message_t& msg)
 {
+    ActivityTimer activityTimer{Activity::signal};
+
     std::string interface;
     std::map<std::string, std::variant<bool>> properties;
 
@@ -471,6 +491,13 @@ void Fan::presenceChanged(sdbusplus::message_t& msg)
         getLogger().log(
             std::format("Fan {} presence state change to {}", _name, _present));
 
+        if (_present)
+        {
+            // A new fan needs a new baseline
+            std::for_each(_sensors.begin(), _sensors.end(),
+                          [](auto& sensor) { sensor->resetDegradation(); });
+        }
+
         if (_present && _setFuncOnPresent)
         {
             updateInventory(true);
@@ -499,6 +526,8 @@ void Fan::presenceChanged(sdbusplus::message_t& msg)
 
 void Fan::sensorErrorTimerExpired(const TachSensor& sensor)
 {
+    ActivityTimer activityTimer{Activity::timer};
+
     if (_present && _system.isPowerOn())
     {
         _system.sensorErrorTimerExpired(*this, sensor);
@@ -15,16 +15,22 @@
  */
 #include "fan_error.hpp"
 
+#include "hwmon_ffdc.hpp"
 #include "logging.hpp"
 #include "sdbusplus.hpp"
+#include "sdeventplus.hpp"
 
+#include <sys/wait.h>
 #include <systemd/sd-journal.h>
 
 #include <nlohmann/json.hpp>
 #include <phosphor-logging/lg2.hpp>
+#include <sdeventplus/source/child.hpp>
 #include <xyz/openbmc_project/Logging/Create/server.hpp>
 
 #include <filesystem>
+#include <fstream>
+#include <list>
 
 namespace phosphor::fan::monitor
 {
@@ -68,6 +74,140 @@ class JournalCloser
     sd_journal* journal{nullptr};
 };
 
+/**
+ * @brief An event log waiting on its FFDC to be collected
+ *        by a child process.
+ */
+struct PendingCommit
+{
+    std::string errorName;
+    std::string fanName;
+    std::string severity;
+    std::map<std::string, std::string> ad;
+
+    // FFDC files that are already complete
+    std::vector<std::pair<FFDCFormat, std::unique_ptr<FFDCFile>>> files;
+
+    // JSON FFDC files being written by the child process
+    std::vector<fs::path> childFiles;
+
+    std::unique_ptr<sdeventplus::source::Child> source;
+    bool done = false;
+};
+
+/**
+ * @brief The event logs waiting on their child processes.
+ *
+ * Entries are marked done in the child callback and removed
+ * on the next commit, as a source can't be freed in its own
+ * callback.
+ */
+static std::list<std::unique_ptr<PendingCommit>> pendingCommits;
+
+/**
+ * @brief Creates an empty temporary file for the child process to
+ *        write FFDC into.
+ *
+ * @return The path, or std::nullopt on failure
+ */
+static std::optional<fs::path> makeTempFile()
+{
+    char tmpFile[] = "/tmp/fanffdc.XXXXXX";
+    auto fd = mkstemp(tmpFile);
+    if (fd == -1)
+    {
+        auto e = errno;
+        getLogger().log(std::format("Failed called to mkstemp, errno = {}", e),
+                        Logger::error);
+        return std::nullopt;
+    }
+    close(fd);
+    return fs::path{tmpFile};
+}
+
+/**
+ * @brief Writes JSON to an existing file
+ *
+ * @param[in] path - The file path
+ * @param[in] data - The JSON to write
+ */
+static void writeJsonFile(const fs::path& path, const json& data)
+{
+    std::ofstream file{path};
+    if (!file)
+    {
+        getLogger().log(
+            std::format("Could not open FFDC file {}", path.string()));
+        return;
+    }
+    file << data.dump();
+}
+
+/**
+ * @brief Calls the D-Bus method to create the event log
+ *
+ * @param[in] commit - The event log data and FFDC
+ */
+static void createEventLog(PendingCommit& commit)
+{
+    FFDCFiles ffdc;
+
+    for (auto& [format, file] : commit.files)
+    {
+        if (file && (file->fd() != -1))
+        {
+            ffdc.emplace_back(format, 0x01, 0x01, file->fd());
+        }
+    }
+
+    try
+    {
+        SDBusPlus::callMethod(loggingService, loggingPath, loggingCreateIface,
+                              "CreateWithFFDCFiles", commit.errorName,
+                              commit.severity, commit.ad, ffdc);
+    }
+    catch (const DBusError& e)
+    {
+        getLogger().log(
+            std::format("Call to create a {} error for fan {} failed: {}",
+                        commit.errorName, commit.fanName, e.what()),
+            Logger::error);
+    }
+
+    // Deletes the files
+    commit.files.clear();
+    commit.done = true;
+}
+
+/**
+ * @brief Adds the files written by the child process as FFDC and
+ *        creates the event log.
+ *
+ * @param[in] commit - The event log data and FFDC
+ * @param[in] si - The child's exit info, or nullptr if the FFDC was
+ *                 collected without a child process.
+ */
+static void finishCommit(PendingCommit& commit, const siginfo_t* si)
+{
+    if (si && ((si->si_code != CLD_EXITED) || (si->si_status != 0)))
+    {
+        getLogger().log(
+            std::format("FFDC collection for {} error did not complete, "
+                        "code = {}, status = {}",
+                        commit.errorName, si->si_code, si->si_status),
+            Logger::error);
+    }
+
+    for (const auto& path : commit.childFiles)
+    {
+        commit.files.emplace_back(FFDCFormat::JSON,
+                                  std::make_unique<FFDCFile>(path));
+    }
+    commit.childFiles.clear();
+
+    createEventLog(commit);
+}
+
 FFDCFile::FFDCFile(const fs::path& name) :
     _fd(open(name.c_str(), O_RDONLY)), _name(name)
 {
@@ -79,52 +219,133 @@ FFDCFile::FFDCFile(const fs::path& name) :
     }
 }
 
-void FanError::commit(const json& jsonFFDC, bool isPowerOffError)
+void FanError::commit(const json& jsonFFDC, bool isPowerOffError,
+                      bool includeHwmonFFDC)
 {
-    FFDCFiles ffdc;
-    auto ad = getAdditionalData(isPowerOffError);
+    pendingCommits.remove_if([](const auto& c) { return c->done; });
+
+    auto commit = std::make_unique<PendingCommit>();
+    commit->errorName = _errorName;
+    commit->fanName = _fanName;
+    commit->severity = _severity;
+    commit->ad = getAdditionalData(isPowerOffError);
 
-    // Add the Logger contents as FFDC
-    auto logFile = makeLogFFDCFile();
-    if (logFile && (logFile->fd() != -1))
+    // If this is a power off, change severity to Critical
+    if (isPowerOffError)
     {
-        ffdc.emplace_back(FFDCFormat::Text, 0x01, 0x01, logFile->fd());
+        using namespace sdbusplus::xyz::openbmc_project::Logging::server;
+        commit->severity = convertForMessage(Entry::Level::Critical);
     }
 
-    // Add the passed in JSON as FFDC
-    auto ffdcFile = makeJsonFFDCFile(jsonFFDC);
-    if (ffdcFile && (ffdcFile->fd() != -1))
+    // The Logger contents and passed in JSON are already in memory,
+    // so save them now so they reflect the time of the error.
+    commit->files.emplace_back(FFDCFormat::Text, makeLogFFDCFile());
+    commit->files.emplace_back(FFDCFormat::JSON, makeJsonFFDCFile(jsonFFDC));
+
+    // The previous systemd journal entries and hwmon data are
+    // left to the child process.
+    auto journalFile = makeTempFile();
+    if (journalFile)
     {
-        ffdc.emplace_back(FFDCFormat::JSON, 0x01, 0x01, ffdcFile->fd());
+        commit->childFiles.push_back(*journalFile);
     }
 
-    // add the previous systemd journal entries as FFDC
-    auto serviceFFDC = makeJsonFFDCFile(getJournalEntries(25));
-    if (serviceFFDC && serviceFFDC->fd() != -1)
+    std::optional<fs::path> hwmonFile;
+    if (includeHwmonFFDC)
     {
-        ffdc.emplace_back(FFDCFormat::JSON, 0x01, 0x01, serviceFFDC->fd());
+        hwmonFile = makeTempFile();
+        if (hwmonFile)
+        {
+            commit->childFiles.push_back(*hwmonFile);
+        }
     }
 
-    try
+    // Returns false if the FFDC couldn't all be collected, like when
+    // dumping journal or kernel messages with invalid UTF-8 throws.
+    auto collect = [this, &journalFile, &hwmonFile]() {
+        try
+        {
+            if (journalFile)
+            {
+                writeJsonFile(*journalFile, getJournalEntries(25));
+            }
+
+            if (hwmonFile)
+            {
+                writeJsonFile(*hwmonFile, collectHwmonFFDC());
+            }
+        }
+        catch (const std::exception& e)
+        {
+            getLogger().log(
+                std::format("Failed collecting FFDC for {} error: {}",
+                            _errorName, e.what()),
+                Logger::error);
+            return false;
+        }
+        return true;
+    };
+
+    // The caller powers off right after a power off error is
+    // committed, so that event log has to exist before this returns.
+    if (isPowerOffError)
     {
-        auto sev = _severity;
+        collect();
+        finishCommit(*commit, nullptr);
+        return;
+    }
 
-        // If this is a power off, change severity to Critical
-        if (isPowerOffError)
+    auto pid = fork();
+    if (pid == 0)
+    {
+        // Only the FFDC collection runs in the child, it doesn't
+        // touch the bus or the event loop.  It must never return from
+        // here, or a copy of the application would keep running.
+        int status = 1;
+        try
         {
-            using namespace sdbusplus::xyz::openbmc_project::Logging::server;
-            sev = convertForMessage(Entry::Level::Critical);
+            status = collect() ? 0 : 1;
         }
-        SDBusPlus::callMethod(loggingService, loggingPath, loggingCreateIface,
-                              "CreateWithFFDCFiles", _errorName, sev, ad, ffdc);
+        catch (...)
+        {}
+        _exit(status);
     }
-    catch (const DBusError& e)
+
+    if (pid > 0)
     {
+        try
+        {
+            auto* c = commit.get();
+            commit->source = std::make_unique<sdeventplus::source::Child>(
+                util::SDEventPlus::getEvent(), pid, WEXITED,
+                [c](sdeventplus::source::Child&, const siginfo_t* si) {
+                    finishCommit(*c, si);
+                });
+
+            pendingCommits.push_back(std::move(commit));
+            return;
+        }
+        catch (const std::exception& e)
+        {
+            getLogger().log(
+                std::format("Could not watch FFDC collection process: {}",
+                            e.what()),
+                Logger::error);
+
+            waitpid(pid, nullptr, 0);
+        }
+    }
+    else
+    {
+        auto e = errno;
         getLogger().log(
-            std::format("Call to create a {} error for fan {} failed: {}",
-                        _errorName, _fanName, e.what()),
+            std::format("Failed to fork for FFDC collection, errno = {}", e),
             Logger::error);
+
+        collect();
     }
+
+    finishCommit(*commit, nullptr);
 }
 
 std::map<std::string, std::string> FanError::getAdditionalData(
@@ -152,6 +373,8 @@ std::map<std::string, std::string> FanError::getAdditionalData(
         ad.emplace("SEVERITY_DETAIL", "SYSTEM_TERM");
     }
 
+    ad.insert(_additionalData.begin(), _additionalData.end());
+
     return ad;
 }
 
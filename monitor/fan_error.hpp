@@ -6,6 +6,7 @@
 #include <xyz/openbmc_project/Logging/Entry/server.hpp>
 
 #include <filesystem>
+#include <map>
 #include <string>
 #include <tuple>
 
@@ -72,6 +73,13 @@ class FFDCFile
  *
  * This class represents a fan error.  It has a commit() interface
  * that will create the event log with certain FFDC.
+ *
+ * The FFDC that is slow to collect, the journal and optionally the
+ * hwmon data, is gathered in a child process so the event loop can
+ * keep processing tach changes in the meantime.  The event log is
+ * created when that child exits.  Power off errors are the exception,
+ * as the power off follows right after, so they are still created
+ * before commit() returns.
  */
 class FanError
 {
@@ -128,12 +136,31 @@ class FanError
      * The FFDC is passed in here so that if an error is committed
      * more than once it can have up to date FFDC.
      *
+     * The event log is created once the child process collecting the
+     * rest of the FFDC exits, or right away if it can't be started or
+     * this is a power off error.
+     *
      * @param[in] jsonFFDC - Free form JSON data that should be sent in as
      *                       FFDC.
      * @param[in] isPowerOffError - If this is committed at the time of the
      *                              power off.
+     * @param[in] includeHwmonFFDC - If the hwmon driver names and kernel
+     *                               messages should be added as FFDC.
      */
-    void commit(const nlohmann::json& jsonFFDC, bool isPowerOffError = false);
+    void commit(const nlohmann::json& jsonFFDC, bool isPowerOffError = false,
+                bool includeHwmonFFDC = false);
+
+    /**
+     * @brief Adds an entry to the event log's AdditionalData, along
+     *        with the ones for the fan, sensor, and power off.
+     *
+     * @param[in] key - The key
+     * @param[in] value - The value
+     */
+    void addAdditionalData(const std::string& key, const std::string& value)
+    {
+        _additionalData[key] = value;
+    }
 
   private:
     /**
@@ -211,6 +238,11 @@ class FanError
      *        representation of the Entry::Level property.
      */
     const std::string _severity;
+
+    /**
+     * @brief Extra AdditionalData entries from the caller
+     */
+    std::map<std::string, std::string> _additionalData;
 };
 
 } // namespace phosphor::fan::monitor
@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include "types.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+
+namespace phosphor::fan::monitor
+{
+
+/**
+ * @brief The fan health totals that the power off causes compare
+ *        against.
+ */
+struct FanHealthCounts
+{
+    // The number of fan FRUs that aren't present
+    size_t missingFans = 0;
+
+    // The number of nonfunctional rotors across all fans
+    size_t nonfuncRotors = 0;
+
+    // The number of fan FRUs with at least one nonfunctional rotor
+    size_t fansWithNonfuncRotors = 0;
+
+    bool operator==(const FanHealthCounts&) const = default;
+
+    /**
+     * @brief Returns the counts contributed by a single fan.
+     *
+     * @param[in] entry - The health of the fan
+     */
+    static FanHealthCounts of(const FanHealthEntry& entry)
+    {
+        const auto& tachs = std::get<sensorFuncHealthPos>(entry);
+        size_t nonfunc = std::count(tachs.begin(), tachs.end(), false);
+
+        return FanHealthCounts{!std::get<presentHealthPos>(entry) ? 1u : 0u,
+                               nonfunc, (nonfunc > 0) ? 1u : 0u};
+    }
+
+    /**
+     * @brief Returns the counts of a whole FanHealth map by
+     *        walking every fan.
+     *
+     * @param[in] fanHealth - The FanHealth map
+     */
+    static FanHealthCounts of(const FanHealth& fanHealth)
+    {
+        FanHealthCounts counts;
+        for (const auto& [name, entry] : fanHealth)
+        {
+            counts += of(entry);
+        }
+        return counts;
+    }
+
+    FanHealthCounts& operator+=(const FanHealthCounts& other)
+    {
+        missingFans += other.missingFans;
+        nonfuncRotors += other.nonfuncRotors;
+        fansWithNonfuncRotors += other.fansWithNonfuncRotors;
+        return *this;
+    }
+
+    FanHealthCounts& operator-=(const FanHealthCounts& other)
+    {
+        missingFans -= other.missingFans;
+        nonfuncRotors -= other.nonfuncRotors;
+        fansWithNonfuncRotors -= other.fansWithNonfuncRotors;
+        return *this;
+    }
+};
+
+/**
+ * @class FanHealthTracker
+ *
+ * Holds the FanHealth map along with its FanHealthCounts, which are
+ * adjusted by the difference between a fan's old and new health each
+ * time it is updated.  This way the power off rules can be checked
+ * without walking every fan on every fan status change.
+ */
+class FanHealthTracker
+{
+  public:
+    FanHealthTracker() = default;
+    ~FanHealthTracker() = default;
+    FanHealthTracker(const FanHealthTracker&) = delete;
+    FanHealthTracker& operator=(const FanHealthTracker&) = delete;
+    FanHealthTracker(FanHealthTracker&&) = delete;
+    FanHealthTracker& operator=(FanHealthTracker&&) = delete;
+
+    /**
+     * @brief Sets the health of a fan, adding it if new.
+     *
+     * @param[in] name - The fan name
+     * @param[in] entry - The fan's health
+     */
+    void update(const std::string& name, FanHealthEntry&& entry)
+    {
+        auto newCounts = FanHealthCounts::of(entry);
+
+        auto it = _fanHealth.find(name);
+        if (it != _fanHealth.end())
+        {
+            _counts -= FanHealthCounts::of(it->second);
+            it->second = std::move(entry);
+        }
+        else
+        {
+            _fanHealth.emplace(name, std::move(entry));
+        }
+
+        _counts += newCounts;
+    }
+
+    /**
+     * @brief Removes all fans.
+     */
+    void clear()
+    {
+        _fanHealth.clear();
+        _counts = FanHealthCounts{};
+    }
+
+    /**
+     * @brief Returns the FanHealth map
+     */
+    const FanHealth& health() const
+    {
+        return _fanHealth;
+    }
+
+    /**
+     * @brief Returns the current counts
+     */
+    const FanHealthCounts& counts() const
+    {
+        return _counts;
+    }
+
+  private:
+    /**
+     * @brief The latest health of all the fans
+     */
+    FanHealth _fanHealth;
+
+    /**
+     * @brief The totals over _fanHealth
+     */
+    FanHealthCounts _counts;
+};
+
+} // namespace phosphor::fan::monitor
@@ -43,6 +43,7 @@ std::vector<PropertyState>{
 #include "types.hpp"
 #include "groups.hpp"
 #include "conditions.hpp"
+#include "tach_history.hpp"
 
 using namespace phosphor::fan::monitor;
 using namespace phosphor::fan::trust;
@@ -96,7 +97,9 @@ const std::vector<FanDefinition> fanDefinitions
                   %else:
                   {},
                   %endif
-                  false // set_func_on_present. Hardcoded to false.
+                  false, // set_func_on_present. Hardcoded to false.
+                  ${fan_data.get('tach_history_depth', 'defaultTachHistoryDepth')},
+                  std::nullopt // degradation - not used in YAML configs
     },
 %endfor
 };
@@ -161,6 +164,11 @@ if __name__ == "__main__":
     for fan in monitor_data.get("fans", {}):
         if (fan["deviation"] < 0) or (fan["deviation"] > 100):
             sys.exit("Invalid deviation value " + str(fan["deviation"]))
+        if fan.get("tach_history_depth", 1) <= 0:
+            sys.exit(
+                "Invalid tach_history_depth value "
+                + str(fan["tach_history_depth"])
+            )
 
     output_file = os.path.join(args.output_dir, "fan_monitor_defs.cpp")
     with open(output_file, "w") as output:
@@ -188,6 +188,44 @@ const std::vector<SensorDefinition> getSensorDefs(const json& sensors)
     return sensorDefs;
 }
 
+std::optional<DegradationConfig> getDegradationConfig(const json& fan)
+{
+    if (!fan.contains("predictive_failure"))
+    {
+        return std::nullopt;
+    }
+
+    const auto& pf = fan["predictive_failure"];
+
+    // All attributes are optional and have defaults suited to a
+    // tach sample every second.
+    DegradationConfig config{
+        .lambda = pf.value("lambda", 0.01),
+        .sigmaLimit = pf.value("sigma_limit", 4.0),
+        .learningSamples = pf.value("learning_samples", size_t{300}),
+        .minDriftPercent = pf.value("min_drift_percent", 2.0),
+        .settleSamples = pf.value("settle_samples", size_t{10})};
+
+    if ((config.lambda <= 0.0) || (config.lambda > 1.0))
+    {
+        lg2::error(
+            "Invalid predictive_failure lambda of {LAMBDA} found, must be greater than 0 and at most 1",
+            "LAMBDA", config.lambda);
+        throw std::runtime_error("Invalid predictive_failure lambda found");
+    }
+
+    if (config.learningSamples < 2)
+    {
+        lg2::error(
+            "Invalid predictive_failure learning_samples of {SAMPLES} found, must be at least 2",
+            "SAMPLES", config.learningSamples);
+        throw std::runtime_error(
+            "Invalid predictive_failure learning_samples found");
+    }
+
+    return config;
+}
+
 const std::vector<FanDefinition> getFanDefs(const json& obj)
 {
     std::vector<FanDefinition> fanDefs;
@@ -362,6 +400,20 @@ const std::vector<FanDefinition> getFanDefs(const json& obj)
             setFuncOnPresent = fan["set_func_on_present"].get<bool>();
         }
 
+        // The number of previous tach and target values to keep
+        // for FFDC is optional and defaults to 8
+        size_t tachHistoryDepth = defaultTachHistoryDepth;
+        if (fan.contains("tach_history_depth"))
+        {
+            tachHistoryDepth = fan["tach_history_depth"].get<size_t>();
+            if (tachHistoryDepth == 0)
+            {
+                lg2::error("Invalid tach_history_depth of 0 found");
+                throw std::runtime_error(
+                    "Invalid tach_history_depth found, must be nonzero");
+            }
+        }
+
         FanDefinition def{
             .name = fan["inventory"].get<std::string>(),
             .method = method,
@@ -376,7 +428,9 @@ const std::vector<FanDefinition> getFanDefs(const json& obj)
             .fanMissingErrDelay = fanMissingErrorDelay,
             .sensorList = std::move(sensorDefs),
             .condition = cond,
-            .funcOnPresent = setFuncOnPresent};
+            .funcOnPresent = setFuncOnPresent,
+            .tachHistoryDepth = tachHistoryDepth,
+            .degradation = getDegradationConfig(fan)};
 
         fanDefs.push_back(std::move(def));
     }
@@ -70,6 +70,15 @@ const std::vector<CreateGroupFunction> getTrustGrps(const json& obj);
  */
 const std::vector<SensorDefinition> getSensorDefs(const json& sensors);
 
+/**
+ * @brief Get the optional predictive failure configuration of a fan
+ *
+ * @param[in] fan - JSON object of the fan definition
+ *
+ * @return The configuration, or std::nullopt if not configured
+ */
+std::optional<DegradationConfig> getDegradationConfig(const json& fan);
+
 /**
  * @brief Get the configured fan definitions to be monitored
  *
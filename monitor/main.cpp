@@ -23,6 +23,7 @@
 #include "dbus_paths.hpp"
 #include "json_config.hpp"
 #include "json_parser.hpp"
+#include "metrics_object.hpp"
 #endif
 #include "system.hpp"
 #include "trust_manager.hpp"
@@ -72,6 +73,10 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
     // handle both sd_events (for the timers) and dbus signals.
     bus.attach_event(event.get(), SD_EVENT_PRIORITY_NORMAL);
 
+    // Event log FFDC is collected in child processes, and the
+    // event loop needs SIGCHLD blocked to watch them.
+    stdplus::signal::block(SIGCHLD);
+
     System system(mode, bus, event);
 
 #ifdef MONITOR_USE_JSON
@@ -92,6 +97,10 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
         std::bind(&System::dumpDebugData, &system, std::placeholders::_1,
                   std::placeholders::_2));
 
+    // Put the fan monitoring metrics on D-Bus
+    phosphor::fan::MetricsObject metrics(
+        bus, std::bind(&System::getMetricGauges, &system));
+
     bus.request_name(THERMAL_ALERT_BUSNAME);
 #else
     system.start();
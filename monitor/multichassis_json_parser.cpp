@@ -260,6 +260,20 @@ const std::vector<FanTypeDefinition> getFanDefs(const json& fans)
             setFuncOnPresent = fan["set_func_on_present"].get<bool>();
         }
 
+        // The number of previous tach and target values to keep
+        // for FFDC is optional and defaults to 8
+        size_t tachHistoryDepth = defaultTachHistoryDepth;
+        if (fan.contains("tach_history_depth"))
+        {
+            tachHistoryDepth = fan["tach_history_depth"].get<size_t>();
+            if (tachHistoryDepth == 0)
+            {
+                lg2::error("Invalid tach_history_depth of 0 found");
+                throw std::runtime_error(
+                    "Invalid tach_history_depth found, must be nonzero");
+            }
+        }
+
         FanTypeDefinition def{
             .type = fan["type"].get<std::string>(),
             .method = method,
@@ -274,7 +288,9 @@ const std::vector<FanTypeDefinition> getFanDefs(const json& fans)
             .fanMissingErrDelay = fanMissingErrorDelay,
             .sensorList = std::move(sensorDefs),
             .condition = cond,
-            .funcOnPresent = setFuncOnPresent};
+            .funcOnPresent = setFuncOnPresent,
+            .tachHistoryDepth = tachHistoryDepth,
+            .degradation = getDegradationConfig(fan)};
 
         fanDefs.push_back(std::move(def));
     }
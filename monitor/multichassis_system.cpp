@@ -129,6 +129,11 @@ json MultiChassisSystem::captureSensorData()
                             json(sensor->getPrevTarget()).dump();
                     }
 
+                    if (const auto* degradation = sensor->getDegradation())
+                    {
+                        values["degradation"] = *degradation;
+                    }
+
                     if (sensor->getMethod() == MethodMode::count)
                     {
                         values["ticks"] = sensor->getCounter();
@@ -45,6 +45,8 @@ struct FanTypeDefinition
     std::vector<SensorDefinition> sensorList;
     std::optional<Condition> condition;
     bool funcOnPresent;
+    size_t tachHistoryDepth;
+    std::optional<DegradationConfig> degradation;
 };
 struct FanAssignment
 {
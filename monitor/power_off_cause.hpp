@@ -1,5 +1,6 @@
 #pragma once
 
+#include "fan_health.hpp"
 #include "types.hpp"
 
 #include <algorithm>
@@ -48,6 +49,19 @@ class PowerOffCause
      */
     virtual bool satisfied(const FanHealth& fanHealth) = 0;
 
+    /**
+     * @brief Pure virtual that says if the system should be powered
+     *        off based on the precomputed fan health counts.
+     *
+     * This gives the same answer as the FanHealth version, but
+     * doesn't have to walk every fan.
+     *
+     * @param[in] counts - The FanHealthCounts
+     *
+     * @return bool - If system should be powered off
+     */
+    virtual bool satisfied(const FanHealthCounts& counts) = 0;
+
     /**
      * @brief Returns the name of the cause.
      *
@@ -116,6 +130,17 @@ class MissingFanFRUCause : public PowerOffCause
 
         return count >= _count;
     }
+
+    /**
+     * @brief Returns true if 'count' or more fans are missing
+     *        to require a power off.
+     *
+     * @param[in] counts - The FanHealthCounts
+     */
+    bool satisfied(const FanHealthCounts& counts) override
+    {
+        return counts.missingFans >= _count;
+    }
 };
 
 /**
@@ -164,6 +189,17 @@ class NonfuncFanRotorCause : public PowerOffCause
 
         return count >= _count;
     }
+
+    /**
+     * @brief Returns true if 'count' or more rotors are nonfunctional
+     *        to require a power off.
+     *
+     * @param[in] counts - The FanHealthCounts
+     */
+    bool satisfied(const FanHealthCounts& counts) override
+    {
+        return counts.nonfuncRotors >= _count;
+    }
 };
 
 /**
@@ -213,6 +249,17 @@ class FanFRUsWithNonfuncRotorsCause : public PowerOffCause
 
         return count >= _count;
     }
+
+    /**
+     * @brief Returns true if 'count' or more fan FRUs have
+     *        nonfunctional rotors.
+     *
+     * @param[in] counts - The FanHealthCounts
+     */
+    bool satisfied(const FanHealthCounts& counts) override
+    {
+        return counts.fansWithNonfuncRotors >= _count;
+    }
 };
 
 } // namespace phosphor::fan::monitor
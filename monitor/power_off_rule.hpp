@@ -76,8 +76,43 @@ class PowerOffRule
      */
     void check(PowerRuleState state, const FanHealth& fanHealth)
     {
-        auto satisfied = _cause->satisfied(fanHealth);
+        apply(state, _cause->satisfied(fanHealth));
+    }
+
+    /**
+     * @brief Checks the cause against the passed in fan health
+     *        counts and starts the power off action if the cause
+     *        is satisfied.
+     *
+     * @param[in] state - The state to check the rule at
+     * @param[in] counts - The fan health counts
+     */
+    void check(PowerRuleState state, const FanHealthCounts& counts)
+    {
+        apply(state, _cause->satisfied(counts));
+    }
+
+    /**
+     * @brief Says if there is an active power off in progress due to
+     *        this rule.
+     *
+     * @return bool - If the rule is active or not
+     */
+    bool active() const
+    {
+        return _active;
+    }
 
+  private:
+    /**
+     * @brief Starts or stops the power off action based on
+     *        the result of the cause check.
+     *
+     * @param[in] state - The state the rule was checked at
+     * @param[in] satisfied - If the cause was satisfied
+     */
+    void apply(PowerRuleState state, bool satisfied)
+    {
         // Only start an action if it matches on the current state,
         // but be able to stop it no matter what the state is.
         if (!_active && satisfied && (state == _validState))
@@ -107,18 +142,6 @@ class PowerOffRule
         }
     }
 
-    /**
-     * @brief Says if there is an active power off in progress due to
-     *        this rule.
-     *
-     * @return bool - If the rule is active or not
-     */
-    bool active() const
-    {
-        return _active;
-    }
-
-  private:
     /**
      * @brief The state the rule is valid for.
      */
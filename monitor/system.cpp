@@ -29,8 +29,6 @@
 
 #include "config.h"
 
-#include "hwmon_ffdc.hpp"
-
 #include <nlohmann/json.hpp>
 #include <phosphor-logging/lg2.hpp>
 #include <sdbusplus/bus.hpp>
@@ -117,7 +115,8 @@ void System::load()
         // off here.
         std::for_each(_powerOffRules.begin(), _powerOffRules.end(),
                       [this](auto& rule) {
-                          rule->check(PowerRuleState::runtime, _fanHealth);
+                          rule->check(PowerRuleState::runtime,
+                                      _fanHealth.counts());
                       });
     }
 
@@ -325,8 +324,8 @@ void System::updateFanHealth(const Fan& fan)
         sensorStatus.push_back(sensor->functional());
     }
 
-    _fanHealth[fan.getName()] =
-        std::make_tuple(fan.present(), std::move(sensorStatus));
+    _fanHealth.update(fan.getName(),
+                      std::make_tuple(fan.present(), std::move(sensorStatus)));
 }
 
 void System::fanStatusChange(const Fan& fan, bool skipRulesCheck)
@@ -337,7 +336,8 @@ void System::fanStatusChange(const Fan& fan, bool skipRulesCheck)
     {
         std::for_each(_powerOffRules.begin(), _powerOffRules.end(),
                       [this](auto& rule) {
-                          rule->check(PowerRuleState::runtime, _fanHealth);
+                          rule->check(PowerRuleState::runtime,
+                                      _fanHealth.counts());
                       });
     }
 }
@@ -403,11 +403,13 @@ void System::powerStateChanged(bool powerStateOn)
 
         std::for_each(_powerOffRules.begin(), _powerOffRules.end(),
                       [this](auto& rule) {
-                          rule->check(PowerRuleState::atPgood, _fanHealth);
+                          rule->check(PowerRuleState::atPgood,
+                                      _fanHealth.counts());
                       });
         std::for_each(_powerOffRules.begin(), _powerOffRules.end(),
                       [this](auto& rule) {
-                          rule->check(PowerRuleState::runtime, _fanHealth);
+                          rule->check(PowerRuleState::runtime,
+                                      _fanHealth.counts());
                       });
     }
     else
@@ -420,6 +422,33 @@ void System::powerStateChanged(bool powerStateOn)
     }
 }
 
+void System::sensorDegradationDetected(const Fan& fan,
+                                       const TachSensor& sensor)
+{
+    std::string fanPath{util::INVENTORY_PATH + fan.getName()};
+    const auto* degradation = sensor.getDegradation();
+
+    getLogger().log(
+        std::format("Predicting failure of fan {} sensor {}. "
+                    "[baseline ratio = {}, current ratio = {}]",
+                    fanPath, sensor.name(), degradation->baseline(),
+                    degradation->ewma()),
+        Logger::error);
+
+    // There isn't a predicted fault error, so it's an informational
+    // Fault with the type and ratios in the AdditionalData.
+    FanError error{"xyz.openbmc_project.Fan.Error.Fault", fanPath,
+                   sensor.name(), Severity::Informational};
+    error.addAdditionalData("FAULT_TYPE", "PredictedFailure");
+    error.addAdditionalData("BASELINE_RATIO",
+                            std::to_string(degradation->baseline()));
+    error.addAdditionalData("CURRENT_RATIO",
+                            std::to_string(degradation->ewma()));
+
+    auto sensorData = captureSensorData();
+    error.commit(sensorData);
+}
+
 void System::sensorErrorTimerExpired(const Fan& fan, const TachSensor& sensor)
 {
     std::string fanPath{util::INVENTORY_PATH + fan.getName()};
@@ -521,6 +550,11 @@ json System::captureSensorData()
                 values["prev_targets"] = json(sensor->getPrevTarget()).dump();
             }
 
+            if (const auto* degradation = sensor->getDegradation())
+            {
+                values["degradation"] = *degradation;
+            }
+
             if (sensor->getMethod() == MethodMode::count)
             {
                 values["ticks"] = sensor->getCounter();
@@ -537,11 +571,11 @@ void System::handleOfflineFanController()
     getLogger().log("The fan controller appears to be offline.  Shutting down.",
                     Logger::error);
 
-    auto ffdc = collectHwmonFFDC();
-
+    // The FFDC, including the hwmon data, is collected before
+    // commit() returns since the power off follows right after.
     FanError error{"xyz.openbmc_project.Fan.Error.FanControllerOffline",
                    Severity::Critical};
-    error.commit(ffdc, true);
+    error.commit(captureSensorData(), true, true);
 
     PowerInterface::executeHardPowerOff();
 
@@ -596,4 +630,16 @@ void System::dumpDebugData(sdeventplus::source::Signal&,
     }
 }
 
+std::map<std::string, int64_t> System::getMetricGauges() const
+{
+    const auto& counts = _fanHealth.counts();
+
+    return {{"loaded", _loaded},
+            {"fans", _fans.size()},
+            {"missing_fans", counts.missingFans},
+            {"nonfunctional_rotors", counts.nonfuncRotors},
+            {"fans_with_nonfunctional_rotors", counts.fansWithNonfuncRotors},
+            {"power_on", isPowerOn()}};
+}
+
 } // namespace phosphor::fan::monitor
@@ -17,6 +17,7 @@
 
 #include "fan.hpp"
 #include "fan_error.hpp"
+#include "fan_health.hpp"
 #include "power_off_rule.hpp"
 #include "power_state.hpp"
 #include "tach_sensor.hpp"
@@ -98,6 +99,17 @@ class System : public ZoneBase
      */
     void fanMissingErrorTimerExpired(const Fan& fan) override;
 
+    /**
+     * @brief Called when a fan sensor's predictive failure detection
+     *        flags a significant drop in speed relative to its target.
+     *        An informational event log will be created.
+     *
+     * @param[in] fan - The parent fan of the sensor
+     * @param[in] sensor - The degrading sensor
+     */
+    void sensorDegradationDetected(const Fan& fan,
+                                   const TachSensor& sensor) override;
+
     /**
      * @brief Called by the power off actions to log an error when there is
      *        a power off due to fan problems.
@@ -133,6 +145,12 @@ class System : public ZoneBase
     void dumpDebugData(sdeventplus::source::Signal&,
                        const struct signalfd_siginfo*);
 
+    /**
+     * @brief Returns the gauges for the metrics D-Bus object, which are
+     *        the fan and rotor health counts and the power state.
+     */
+    std::map<std::string, int64_t> getMetricGauges() const;
+
   private:
     /**
      * @brief Callback from D-Bus when Inventory service comes online
@@ -167,7 +185,7 @@ class System : public ZoneBase
     /**
      * @brief The latest health of all the fans
      */
-    FanHealth _fanHealth;
+    FanHealthTracker _fanHealth;
 
     /**
      * @brief The object to watch the power state
@@ -0,0 +1,266 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace phosphor::fan::monitor
+{
+
+/**
+ * @brief The default number of samples kept in a TachHistory
+ */
+constexpr size_t defaultTachHistoryDepth = 8;
+
+/**
+ * @class TachHistory
+ *
+ * A fixed capacity ring buffer of timestamped tach (or target) values
+ * along with running statistics on every value ever added.
+ *
+ * The storage is allocated once in the constructor, so adding a sample
+ * never allocates.  When the buffer is full the oldest sample is
+ * overwritten.
+ *
+ * The statistics (min, max, mean, variance) cover all samples added
+ * since construction or the last reset(), not just the ones still held
+ * in the buffer, and are updated in constant time using Welford's
+ * algorithm.
+ */
+class TachHistory
+{
+  public:
+    using Clock = std::chrono::system_clock;
+
+    struct Sample
+    {
+        Clock::time_point time;
+        uint64_t value;
+    };
+
+    TachHistory() = delete;
+    ~TachHistory() = default;
+    TachHistory(const TachHistory&) = delete;
+    TachHistory& operator=(const TachHistory&) = delete;
+    TachHistory(TachHistory&&) = default;
+    TachHistory& operator=(TachHistory&&) = default;
+
+    /**
+     * @brief Constructor
+     *
+     * @param[in] depth - The number of samples to hold.  Must be nonzero.
+     */
+    explicit TachHistory(size_t depth) : _samples(std::max<size_t>(depth, 1))
+    {}
+
+    /**
+     * @brief Adds a sample, overwriting the oldest one if full.
+     *
+     * @param[in] value - The value to add
+     * @param[in] time - The time of the sample
+     */
+    void push(uint64_t value, Clock::time_point time = Clock::now())
+    {
+        _head = (_head + 1) % _samples.size();
+        _samples[_head] = Sample{time, value};
+
+        if (_size < _samples.size())
+        {
+            _size++;
+        }
+
+        _count++;
+        _min = std::min(_min, value);
+        _max = std::max(_max, value);
+
+        auto delta = static_cast<double>(value) - _mean;
+        _mean += delta / static_cast<double>(_count);
+        _m2 += delta * (static_cast<double>(value) - _mean);
+    }
+
+    /**
+     * @brief Returns the most recent sample.  Only valid if !empty().
+     */
+    const Sample& front() const
+    {
+        return _samples[_head];
+    }
+
+    /**
+     * @brief Returns the sample 'index' places back from the newest,
+     *        so at(0) == front().  Only valid if index < size().
+     */
+    const Sample& at(size_t index) const
+    {
+        return _samples[(_head + _samples.size() - index) % _samples.size()];
+    }
+
+    /**
+     * @brief Returns true if no samples have been added.
+     */
+    bool empty() const
+    {
+        return _size == 0;
+    }
+
+    /**
+     * @brief Returns the number of samples currently held.
+     */
+    size_t size() const
+    {
+        return _size;
+    }
+
+    /**
+     * @brief Returns the maximum number of samples held.
+     */
+    size_t capacity() const
+    {
+        return _samples.size();
+    }
+
+    /**
+     * @brief Returns the number of samples ever added.
+     */
+    uint64_t count() const
+    {
+        return _count;
+    }
+
+    /**
+     * @brief Returns the minimum value ever added, or 0 if none.
+     */
+    uint64_t min() const
+    {
+        return _count ? _min : 0;
+    }
+
+    /**
+     * @brief Returns the maximum value ever added, or 0 if none.
+     */
+    uint64_t max() const
+    {
+        return _max;
+    }
+
+    /**
+     * @brief Returns the mean of all values ever added.
+     */
+    double mean() const
+    {
+        return _mean;
+    }
+
+    /**
+     * @brief Returns the sample variance of all values ever added.
+     */
+    double variance() const
+    {
+        return (_count > 1) ? _m2 / static_cast<double>(_count - 1) : 0.0;
+    }
+
+    /**
+     * @brief Returns the held values, newest first.
+     */
+    std::vector<uint64_t> values() const
+    {
+        std::vector<uint64_t> values;
+        values.reserve(_size);
+        for (size_t i = 0; i < _size; i++)
+        {
+            values.push_back(at(i).value);
+        }
+        return values;
+    }
+
+    /**
+     * @brief Clears the samples and the statistics.
+     */
+    void reset()
+    {
+        _head = 0;
+        _size = 0;
+        _count = 0;
+        _min = std::numeric_limits<uint64_t>::max();
+        _max = 0;
+        _mean = 0.0;
+        _m2 = 0.0;
+    }
+
+  private:
+    /**
+     * @brief The sample storage, sized once on construction.
+     */
+    std::vector<Sample> _samples;
+
+    /**
+     * @brief Index of the newest sample
+     */
+    size_t _head = 0;
+
+    /**
+     * @brief Number of valid samples in _samples
+     */
+    size_t _size = 0;
+
+    /**
+     * @brief Number of samples ever added
+     */
+    uint64_t _count = 0;
+
+    /**
+     * @brief Running minimum
+     */
+    uint64_t _min = std::numeric_limits<uint64_t>::max();
+
+    /**
+     * @brief Running maximum
+     */
+    uint64_t _max = 0;
+
+    /**
+     * @brief Running mean
+     */
+    double _mean = 0.0;
+
+    /**
+     * @brief Running sum of squared differences from the mean
+     */
+    double _m2 = 0.0;
+};
+
+/**
+ * @brief Converts a TachHistory to JSON for FFDC and debug dumps.
+ *
+ * Samples are listed newest first as [epoch milliseconds, value] pairs.
+ */
+inline void to_json(nlohmann::json& j, const TachHistory& history)
+{
+    using namespace std::chrono;
+
+    auto samples = nlohmann::json::array();
+    for (size_t i = 0; i < history.size(); i++)
+    {
+        const auto& sample = history.at(i);
+        samples.push_back(
+            {duration_cast<milliseconds>(sample.time.time_since_epoch())
+                 .count(),
+             sample.value});
+    }
+
+    j = nlohmann::json{{"samples", std::move(samples)},
+                       {"count", history.count()},
+                       {"min", history.min()},
+                       {"max", history.max()},
+                       {"mean", history.mean()},
+                       {"variance", history.variance()}};
+}
+
+} // namespace phosphor::fan::monitor
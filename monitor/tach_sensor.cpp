@@ -16,6 +16,7 @@
 #include "tach_sensor.hpp"
 
 #include "fan.hpp"
+#include "metrics.hpp"
 #include "sdbusplus.hpp"
 #include "utility.hpp"
 
@@ -36,8 +37,6 @@ namespace monitor
 
 constexpr auto FAN_TARGET_PROPERTY = "Target";
 constexpr auto FAN_VALUE_PROPERTY = "Value";
-constexpr auto MAX_PREV_TACHS = 8;
-constexpr auto MAX_PREV_TARGETS = 8;
 
 namespace fs = std::filesystem;
 using InternalFailure =
@@ -78,21 +77,26 @@ TachSensor::TachSensor([[maybe_unused]] Mode mode, sdbusplus::bus_t& bus,
                        const std::string& path, double factor, int64_t offset,
                        size_t method, size_t threshold, bool ignoreAboveMax,
                        size_t timeout, const std::optional<size_t>& errorDelay,
-                       size_t countInterval, const sdeventplus::Event& event) :
+                       size_t countInterval, size_t historyDepth,
+                       const std::optional<DegradationConfig>& degradation,
+                       const sdeventplus::Event& event) :
     _bus(bus), _fan(fan), _name(FAN_SENSOR_PATH + id),
     _invName(fs::path(fan.getName()) / id), _hasTarget(hasTarget),
     _funcDelay(funcDelay), _interface(interface), _path(path), _factor(factor),
     _offset(offset), _method(method), _threshold(threshold),
     _ignoreAboveMax(ignoreAboveMax), _timeout(timeout),
     _timerMode(TimerMode::func),
-    _timer(event, std::bind(&Fan::updateState, &fan, std::ref(*this))),
-    _errorDelay(errorDelay), _countInterval(countInterval)
+    _timer(event,
+           [this](auto&) {
+               ActivityTimer activityTimer{Activity::timer};
+               _fan.updateState(*this);
+           }),
+    _errorDelay(errorDelay), _countInterval(countInterval),
+    _prevTargets(historyDepth), _prevTachs(historyDepth)
 {
-    _prevTachs.resize(MAX_PREV_TACHS);
-
-    if (_hasTarget)
+    if (degradation)
     {
-        _prevTargets.resize(MAX_PREV_TARGETS);
+        _degradation.emplace(*degradation);
     }
 
     updateInventory(_functional);
@@ -172,19 +176,19 @@ void TachSensor::updateTachAndTarget()
                          _tachTarget);
         }
 
-        // record previous target value
-        if (_prevTargets.front() != _tachTarget)
-        {
-            _prevTargets.push_front(_tachTarget);
-
-            _prevTargets.pop_back();
-        }
+        recordTarget();
     }
 
     // record previous tach value
-    _prevTachs.push_front(_tachInput);
+    _prevTachs.push(static_cast<uint64_t>(_tachInput));
+}
 
-    _prevTachs.pop_back();
+void TachSensor::recordTarget()
+{
+    if (_prevTargets.empty() || _prevTargets.front().value != _tachTarget)
+    {
+        _prevTargets.push(_tachTarget);
+    }
 }
 
 std::string TachSensor::getMatchString(const std::optional<std::string> path,
@@ -286,22 +290,21 @@ void TachSensor::setFunctional(bool functional, bool skipErrorTimer)
 
 void TachSensor::handleTargetChange(sdbusplus::message_t& msg)
 {
+    ActivityTimer activityTimer{Activity::signal};
+
     readPropertyFromMessage(msg, _interface, FAN_TARGET_PROPERTY, _tachTarget);
 
     // Check all tach sensors on the fan against the target
     _fan.tachChanged();
 
     // record previous target value
-    if (_prevTargets.front() != _tachTarget)
-    {
-        _prevTargets.push_front(_tachTarget);
-
-        _prevTargets.pop_back();
-    }
+    recordTarget();
 }
 
 void TachSensor::handleTachChange(sdbusplus::message_t& msg)
 {
+    ActivityTimer activityTimer{Activity::signal};
+
     readPropertyFromMessage(msg, util::FAN_SENSOR_VALUE_INTF,
                             FAN_VALUE_PROPERTY, _tachInput);
 
@@ -309,9 +312,46 @@ void TachSensor::handleTachChange(sdbusplus::message_t& msg)
     _fan.tachChanged(*this);
 
     // record previous tach value
-    _prevTachs.push_front(_tachInput);
+    _prevTachs.push(static_cast<uint64_t>(_tachInput));
+}
 
-    _prevTachs.pop_back();
+bool TachSensor::updateDegradation()
+{
+    if (!_degradation)
+    {
+        return false;
+    }
+
+    auto target = getTarget();
+    if (target != _degradationTarget)
+    {
+        _degradationTarget = target;
+        _samplesSinceTargetChange = 0;
+    }
+
+    if (_samplesSinceTargetChange < _degradation->config().settleSamples)
+    {
+        _samplesSinceTargetChange++;
+        return false;
+    }
+
+    // The speed the rotor should be running at, same as getRange()
+    auto expected = static_cast<double>(target) * _factor + _offset;
+    if (expected <= 0)
+    {
+        return false;
+    }
+
+    return _degradation->update(_tachInput / expected);
+}
+
+void TachSensor::resetDegradation()
+{
+    if (_degradation)
+    {
+        _degradation->reset();
+        _samplesSinceTargetChange = 0;
+    }
 }
 
 void TachSensor::startTimer(TimerMode mode)
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "degradation_detector.hpp"
+#include "tach_history.hpp"
+
 #include <phosphor-logging/lg2.hpp>
 #include <sdbusplus/bus.hpp>
 #include <sdbusplus/bus/match.hpp>
@@ -8,7 +11,6 @@
 #include <sdeventplus/utility/timer.hpp>
 
 #include <chrono>
-#include <deque>
 #include <optional>
 #include <utility>
 
@@ -101,6 +103,10 @@ class TachSensor
      * @param[in] errorDelay - Delay in seconds before creating an error
      *                         or std::nullopt if no errors.
      * @param[in] countInterval - In count mode interval
+     * @param[in] historyDepth - Number of previous tach and target values
+     *                           to keep for FFDC
+     * @param[in] degradation - The predictive failure detection config,
+     *                          or std::nullopt if not enabled.
      *
      * @param[in] event - Event loop reference
      */
@@ -110,6 +116,8 @@ class TachSensor
                double factor, int64_t offset, size_t method, size_t threshold,
                bool ignoreAboveMax, size_t timeout,
                const std::optional<size_t>& errorDelay, size_t countInterval,
+               size_t historyDepth,
+               const std::optional<DegradationConfig>& degradation,
                const sdeventplus::Event& event);
 
     /**
@@ -366,17 +374,43 @@ class TachSensor
     void updateTachAndTarget();
 
     /**
-     * @brief return the previous tach values
+     * @brief Feeds the current tach/target ratio into the predictive
+     *        failure detector, if enabled.
+     *
+     * Samples taken while the rotor is settling after a target change
+     * are skipped.
+     *
+     * @return bool - true if a predicted failure was just flagged
+     */
+    bool updateDegradation();
+
+    /**
+     * @brief Starts the predictive failure detector over with learning
+     *        a new baseline.
+     */
+    void resetDegradation();
+
+    /**
+     * @brief Returns the predictive failure detector, or nullptr
+     *        if not enabled.
+     */
+    const DegradationDetector* getDegradation() const
+    {
+        return _degradation ? &*_degradation : nullptr;
+    }
+
+    /**
+     * @brief return the previous tach values and their statistics
      */
-    const std::deque<uint64_t>& getPrevTach() const
+    const TachHistory& getPrevTach() const
     {
         return _prevTachs;
     }
 
     /**
-     * @brief return the previous target values
+     * @brief return the previous target values and their statistics
      */
-    const std::deque<uint64_t>& getPrevTarget() const
+    const TachHistory& getPrevTarget() const
     {
         return _prevTargets;
     }
@@ -414,6 +448,11 @@ class TachSensor
      */
     void updateInventory(bool functional);
 
+    /**
+     * @brief Adds the current target to _prevTargets if it changed
+     */
+    void recordTarget();
+
     /**
      * @brief the dbus object
      */
@@ -568,12 +607,27 @@ class TachSensor
     /**
      * @brief record of previous targets
      */
-    std::deque<uint64_t> _prevTargets;
+    TachHistory _prevTargets;
 
     /**
      * @brief record of previous tach readings
      */
-    std::deque<uint64_t> _prevTachs;
+    TachHistory _prevTachs;
+
+    /**
+     * @brief The predictive failure detector, if enabled
+     */
+    std::optional<DegradationDetector> _degradation;
+
+    /**
+     * @brief The target used for the last degradation sample
+     */
+    uint64_t _degradationTarget = 0;
+
+    /**
+     * @brief Samples seen since the target last changed
+     */
+    size_t _samplesSinceTargetChange = 0;
 };
 
 } // namespace monitor
@@ -0,0 +1,81 @@
+#include "../degradation_detector.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace phosphor::fan::monitor;
+
+namespace
+{
+const DegradationConfig config{.lambda = 0.1,
+                               .sigmaLimit = 4.0,
+                               .learningSamples = 10,
+                               .minDriftPercent = 2.0,
+                               .settleSamples = 0};
+}
+
+TEST(DegradationDetectorTest, StableTest)
+{
+    DegradationDetector detector{config};
+
+    // Noise around a ratio of 1.0 shouldn't trip it
+    for (size_t i = 0; i < 1000; i++)
+    {
+        EXPECT_FALSE(detector.update((i % 2) ? 1.01 : 0.99));
+    }
+
+    EXPECT_TRUE(detector.learned());
+    EXPECT_FALSE(detector.predictedFailure());
+    EXPECT_NEAR(detector.baseline(), 1.0, 0.001);
+}
+
+TEST(DegradationDetectorTest, DriftTest)
+{
+    DegradationDetector detector{config};
+
+    for (size_t i = 0; i < 10; i++)
+    {
+        EXPECT_FALSE(detector.update((i % 2) ? 1.01 : 0.99));
+    }
+    EXPECT_TRUE(detector.learned());
+
+    // Slowly drift down.  It must be flagged exactly once, and before
+    // dropping by the 15% a typical deviation setting would catch.
+    size_t flagged = 0;
+    double ratio = 1.0;
+    double flaggedAt = 0.0;
+    while (ratio > 0.8)
+    {
+        ratio -= 0.001;
+        if (detector.update(ratio))
+        {
+            flagged++;
+            flaggedAt = ratio;
+        }
+    }
+
+    EXPECT_EQ(flagged, 1);
+    EXPECT_TRUE(detector.predictedFailure());
+    EXPECT_GT(flaggedAt, 0.85);
+
+    // Starts over after a reset
+    detector.reset();
+    EXPECT_FALSE(detector.learned());
+    EXPECT_FALSE(detector.predictedFailure());
+}
+
+TEST(DegradationDetectorTest, MinDriftTest)
+{
+    DegradationDetector detector{config};
+
+    // A perfectly quiet baseline still needs the minimum drift
+    for (size_t i = 0; i < 10; i++)
+    {
+        detector.update(1.0);
+    }
+    EXPECT_DOUBLE_EQ(detector.limit(), 0.98);
+
+    for (size_t i = 0; i < 100; i++)
+    {
+        EXPECT_FALSE(detector.update(0.99));
+    }
+}
@@ -0,0 +1,76 @@
+#include "../fan_health.hpp"
+#include "../power_off_cause.hpp"
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+using namespace phosphor::fan::monitor;
+
+TEST(FanHealthTest, CountsTest)
+{
+    FanHealthTracker tracker;
+    EXPECT_EQ(tracker.counts(), FanHealthCounts{});
+
+    tracker.update("fan0", {true, {true, true}});
+    tracker.update("fan1", {true, {true, true}});
+    EXPECT_EQ(tracker.counts(), (FanHealthCounts{0, 0, 0}));
+
+    tracker.update("fan0", {false, {true, true}});
+    EXPECT_EQ(tracker.counts(), (FanHealthCounts{1, 0, 0}));
+
+    tracker.update("fan1", {true, {false, false}});
+    EXPECT_EQ(tracker.counts(), (FanHealthCounts{1, 2, 1}));
+
+    tracker.update("fan0", {false, {false, true}});
+    EXPECT_EQ(tracker.counts(), (FanHealthCounts{1, 3, 2}));
+
+    // Setting the same health again doesn't change anything
+    tracker.update("fan0", {false, {false, true}});
+    EXPECT_EQ(tracker.counts(), (FanHealthCounts{1, 3, 2}));
+
+    tracker.update("fan0", {true, {true, true}});
+    EXPECT_EQ(tracker.counts(), (FanHealthCounts{0, 2, 1}));
+
+    tracker.clear();
+    EXPECT_TRUE(tracker.health().empty());
+    EXPECT_EQ(tracker.counts(), FanHealthCounts{});
+}
+
+// Make random health changes and check the incremental counts,
+// and the causes that use them, always match a full recount.
+TEST(FanHealthTest, MatchesRecountTest)
+{
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<size_t> fanDist{0, 9};
+    std::uniform_int_distribution<size_t> rotorDist{1, 3};
+    std::bernoulli_distribution presentDist{0.8};
+    std::bernoulli_distribution funcDist{0.7};
+
+    FanHealthTracker tracker;
+
+    MissingFanFRUCause missing{2};
+    NonfuncFanRotorCause nonfuncRotors{3};
+    FanFRUsWithNonfuncRotorsCause nonfuncFans{2};
+
+    for (size_t i = 0; i < 2000; i++)
+    {
+        std::vector<bool> rotors(rotorDist(gen));
+        for (size_t r = 0; r < rotors.size(); r++)
+        {
+            rotors[r] = funcDist(gen);
+        }
+
+        tracker.update("fan" + std::to_string(fanDist(gen)),
+                       {presentDist(gen), std::move(rotors)});
+
+        const auto& health = tracker.health();
+        const auto& counts = tracker.counts();
+
+        ASSERT_EQ(counts, FanHealthCounts::of(health));
+        ASSERT_EQ(missing.satisfied(counts), missing.satisfied(health));
+        ASSERT_EQ(nonfuncRotors.satisfied(counts),
+                  nonfuncRotors.satisfied(health));
+        ASSERT_EQ(nonfuncFans.satisfied(counts), nonfuncFans.satisfied(health));
+    }
+}
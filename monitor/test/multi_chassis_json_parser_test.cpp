@@ -132,7 +132,9 @@ TEST(MultiChassisJsonParserTest, FanDefsTest)
                  .threshold = 30,
                  .ignoreAboveMax = false}},
         .condition = std::optional<phosphor::fan::monitor::Condition>(),
-        .funcOnPresent = true}};
+        .funcOnPresent = true,
+        .tachHistoryDepth = 8,
+        .degradation = std::nullopt}};
 
     ASSERT_EQ(actual.size(), expected.size());
     for (size_t i = 0; i < actual.size(); i++)
@@ -173,6 +175,9 @@ TEST(MultiChassisJsonParserTest, FanDefsTest)
         EXPECT_EQ(actual[i].condition.has_value(),
                   expected[i].condition.has_value());
         EXPECT_EQ(actual[i].funcOnPresent, expected[i].funcOnPresent);
+        EXPECT_EQ(actual[i].tachHistoryDepth, expected[i].tachHistoryDepth);
+        EXPECT_EQ(actual[i].degradation.has_value(),
+                  expected[i].degradation.has_value());
     }
 }
 
@@ -0,0 +1,74 @@
+#include "../tach_history.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace phosphor::fan::monitor;
+
+TEST(TachHistoryTest, RingTest)
+{
+    TachHistory history{3};
+
+    EXPECT_TRUE(history.empty());
+    EXPECT_EQ(history.capacity(), 3);
+    EXPECT_TRUE(history.values().empty());
+
+    history.push(100);
+    history.push(200);
+    EXPECT_EQ(history.size(), 2);
+    EXPECT_EQ(history.front().value, 200);
+    EXPECT_EQ(history.values(), (std::vector<uint64_t>{200, 100}));
+
+    history.push(300);
+    history.push(400);
+    history.push(500);
+
+    // Only the newest 3 are kept
+    EXPECT_EQ(history.size(), 3);
+    EXPECT_EQ(history.count(), 5);
+    EXPECT_EQ(history.values(), (std::vector<uint64_t>{500, 400, 300}));
+
+    history.reset();
+    EXPECT_TRUE(history.empty());
+    EXPECT_EQ(history.count(), 0);
+    EXPECT_EQ(history.min(), 0);
+    EXPECT_EQ(history.max(), 0);
+}
+
+TEST(TachHistoryTest, StatsTest)
+{
+    TachHistory history{2};
+
+    for (uint64_t value : {2, 4, 4, 4, 5, 5, 7, 9})
+    {
+        history.push(value);
+    }
+
+    // The statistics cover all samples, not just the ones held
+    EXPECT_EQ(history.min(), 2);
+    EXPECT_EQ(history.max(), 9);
+    EXPECT_DOUBLE_EQ(history.mean(), 5.0);
+    EXPECT_DOUBLE_EQ(history.variance(), 32.0 / 7.0);
+}
+
+TEST(TachHistoryTest, JsonTest)
+{
+    using namespace std::chrono;
+
+    TachHistory history{4};
+    TachHistory::Clock::time_point time{milliseconds{1000}};
+
+    history.push(5000, time);
+    history.push(5100, time + milliseconds{500});
+
+    auto j = nlohmann::json(history);
+
+    ASSERT_EQ(j["samples"].size(), 2);
+    EXPECT_EQ(j["samples"][0][0].get<int64_t>(), 1500);
+    EXPECT_EQ(j["samples"][0][1].get<uint64_t>(), 5100);
+    EXPECT_EQ(j["samples"][1][0].get<int64_t>(), 1000);
+    EXPECT_EQ(j["samples"][1][1].get<uint64_t>(), 5000);
+    EXPECT_EQ(j["count"].get<uint64_t>(), 2);
+    EXPECT_EQ(j["min"].get<uint64_t>(), 5000);
+    EXPECT_EQ(j["max"].get<uint64_t>(), 5100);
+    EXPECT_DOUBLE_EQ(j["mean"].get<double>(), 5050.0);
+}
@@ -127,6 +127,8 @@ struct FanDefinition
     std::vector<SensorDefinition> sensorList;
     std::optional<Condition> condition;
     bool funcOnPresent;
+    size_t tachHistoryDepth;
+    std::optional<DegradationConfig> degradation;
 };
 
 constexpr auto presentHealthPos = 0;
@@ -3,7 +3,6 @@
 
 #include "zone.hpp"
 
-#include "hwmon_ffdc.hpp"
 #include "json_parser.hpp"
 #include "logging.hpp"
 #include "multichassis_json_parser.hpp"
@@ -66,7 +65,8 @@ void Zone::fanStatusChange(const Fan& fan, bool skipRulesCheck)
     {
         std::for_each(_powerOffRules.begin(), _powerOffRules.end(),
                       [this](auto& rule) {
-                          rule->check(PowerRuleState::runtime, _fanHealth);
+                          rule->check(PowerRuleState::runtime,
+                                      _fanHealth.counts());
                       });
     }
 }
@@ -89,6 +89,33 @@ void Zone::fanMissingErrorTimerExpired(const Fan& fan)
     _lastError = std::move(error);
 }
 
+void Zone::sensorDegradationDetected(const Fan& fan,
+                                     const TachSensor& sensor)
+{
+    std::string fanPath{util::INVENTORY_PATH + fan.getName()};
+    const auto* degradation = sensor.getDegradation();
+
+    getLogger().log(
+        std::format("Predicting failure of fan {} sensor {}. "
+                    "[baseline ratio = {}, current ratio = {}]",
+                    fanPath, sensor.name(), degradation->baseline(),
+                    degradation->ewma()),
+        Logger::error);
+
+    // There isn't a predicted fault error, so it's an informational
+    // Fault with the type and ratios in the AdditionalData.
+    FanError error{"xyz.openbmc_project.Fan.Error.Fault", fanPath,
+                   sensor.name(), Severity::Informational};
+    error.addAdditionalData("FAULT_TYPE", "PredictedFailure");
+    error.addAdditionalData("BASELINE_RATIO",
+                            std::to_string(degradation->baseline()));
+    error.addAdditionalData("CURRENT_RATIO",
+                            std::to_string(degradation->ewma()));
+
+    auto sensorData = captureSensorData();
+    error.commit(sensorData);
+}
+
 void Zone::sensorErrorTimerExpired(const Fan& fan, const TachSensor& sensor)
 {
     std::string fanPath{util::INVENTORY_PATH + fan.getName()};
@@ -160,6 +187,11 @@ json Zone::captureSensorData()
                 values["prev_targets"] = json(sensor->getPrevTarget()).dump();
             }
 
+            if (const auto* degradation = sensor->getDegradation())
+            {
+                values["degradation"] = *degradation;
+            }
+
             if (sensor->getMethod() == MethodMode::count)
             {
                 values["ticks"] = sensor->getCounter();
@@ -250,8 +282,8 @@ void Zone::updateFanHealth(const Fan& fan)
         sensorStatus.push_back(sensor->functional());
     }
 
-    _fanHealth[fan.getName()] =
-        std::make_tuple(fan.present(), std::move(sensorStatus));
+    _fanHealth.update(fan.getName(),
+                      std::make_tuple(fan.present(), std::move(sensorStatus)));
 }
 
 void Zone::tachSignalOffline(sdbusplus::message_t& msg,
@@ -330,11 +362,13 @@ void Zone::powerStateChanged(bool powerStateOn)
 
         std::for_each(_powerOffRules.begin(), _powerOffRules.end(),
                       [this](auto& rule) {
-                          rule->check(PowerRuleState::atPgood, _fanHealth);
+                          rule->check(PowerRuleState::atPgood,
+                                      _fanHealth.counts());
                       });
         std::for_each(_powerOffRules.begin(), _powerOffRules.end(),
                       [this](auto& rule) {
-                          rule->check(PowerRuleState::runtime, _fanHealth);
+                          rule->check(PowerRuleState::runtime,
+                                      _fanHealth.counts());
                       });
     }
     else
@@ -365,11 +399,11 @@ void Zone::handleOfflineFanController()
     getLogger().log("The fan controller appears to be offline.  Shutting down.",
                     Logger::error);
 
-    auto ffdc = collectHwmonFFDC();
-
+    // The FFDC, including the hwmon data, is collected before
+    // commit() returns since the power off follows right after.
     FanError error{"xyz.openbmc_project.Fan.Error.FanControllerOffline",
                    Severity::Critical};
-    error.commit(ffdc, true);
+    error.commit(captureSensorData(), true, true);
 
     PowerInterface::executeHardPowerOff();
 
@@ -453,7 +487,8 @@ void Zone::init(const ZoneDefinition& zoneConfig,
         // off here.
         std::for_each(_powerOffRules.begin(), _powerOffRules.end(),
                       [this](auto& rule) {
-                          rule->check(PowerRuleState::runtime, _fanHealth);
+                          rule->check(PowerRuleState::runtime,
+                                      _fanHealth.counts());
                       });
     }
 
@@ -499,7 +534,9 @@ FanDefinition Zone::getFullDefFromType(const FanTypeDefinition& fanType,
         .fanMissingErrDelay = fanType.fanMissingErrDelay,
         .sensorList = std::move(fullSensorList),
         .condition = fanType.condition,
-        .funcOnPresent = fanType.funcOnPresent};
+        .funcOnPresent = fanType.funcOnPresent,
+        .tachHistoryDepth = fanType.tachHistoryDepth,
+        .degradation = fanType.degradation};
 }
 
 void Zone::setFans(const ZoneDefinition& zoneConfig,
@@ -5,6 +5,7 @@
 
 #include "fan.hpp"
 #include "fan_error.hpp"
+#include "fan_health.hpp"
 #include "multichassis_types.hpp"
 #include "power_off_rule.hpp"
 #include "power_state.hpp"
@@ -110,6 +111,17 @@ class Zone : public phosphor::fan::monitor::ZoneBase
      */
     void fanMissingErrorTimerExpired(const Fan& fan) override;
 
+    /**
+     * @brief Called when a fan sensor's predictive failure detection
+     *        flags a significant drop in speed relative to its target.
+     *        An informational event log will be created.
+     *
+     * @param[in] fan - The parent fan of the sensor
+     * @param[in] sensor - The degrading sensor
+     */
+    void sensorDegradationDetected(const Fan& fan,
+                                   const TachSensor& sensor) override;
+
     /**
      * @brief Called when a fan sensor's error timer expires, which
      *        happens when the sensor has been nonfunctional for a
@@ -176,7 +188,7 @@ class Zone : public phosphor::fan::monitor::ZoneBase
     /**
      * @brief The latest health of all the fans
      */
-    FanHealth _fanHealth;
+    FanHealthTracker _fanHealth;
 
     /**
      * @brief The power off rules, for shutting down the system
@@ -61,6 +61,17 @@ class ZoneBase
     virtual void sensorErrorTimerExpired(const Fan& fan,
                                          const TachSensor& sensor) = 0;
 
+    /**
+     * @brief Called when a fan sensor's predictive failure detection
+     *        flags a significant drop in speed relative to its target.
+     *        An informational event log will be created.
+     *
+     * @param[in] fan - The parent fan of the sensor
+     * @param[in] sensor - The degrading sensor
+     */
+    virtual void sensorDegradationDetected(const Fan& fan,
+                                           const TachSensor& sensor) = 0;
+
     /**
      * @brief Called by the power off actions to log an error when there is
      *        a power off due to fan problems.
@@ -1,13 +1,16 @@
 #pragma once
 
 #include "sdeventplus.hpp"
+#include "sysfs_worker.hpp"
 
 #include <phosphor-logging/lg2.hpp>
 #include <sdeventplus/clock.hpp>
 #include <sdeventplus/utility/timer.hpp>
 
+#include <atomic>
 #include <filesystem>
 #include <fstream>
+#include <memory>
 #include <string>
 
 namespace phosphor::fan::presence
@@ -20,6 +23,10 @@ using namespace phosphor::fan::util;
  * Provides an API to bind an EEPROM driver to a device, after waiting
  * a configurable amount of time in case the device needs time
  * to initialize after being plugged into a system.
+ *
+ * The sysfs bind and unbind writes, which block while the driver
+ * probes the device, are done on the SysfsWorker thread.  A bind that
+ * is still waiting there when the fan is unplugged again is skipped.
  */
 class EEPROMDevice
 {
@@ -41,7 +48,7 @@ class EEPROMDevice
      */
     EEPROMDevice(const std::string& address, const std::string& driver,
                  size_t bindDelayInMS) :
-        address(address), path(baseDriverPath / driver),
+        device(std::make_shared<Device>(address, baseDriverPath / driver)),
         bindDelay(bindDelayInMS),
         timer(SDEventPlus::getEvent(),
               std::bind(std::mem_fn(&EEPROMDevice::bindTimerExpired), this))
@@ -56,7 +63,8 @@ class EEPROMDevice
     }
 
     /**
-     * @brief Stops the bind timer if running and unbinds the device
+     * @brief Stops the bind timer if running, cancels a bind
+     *        that hasn't started yet, and unbinds the device
      */
     void unbind()
     {
@@ -65,71 +73,133 @@ class EEPROMDevice
             timer.setEnabled(false);
         }
 
-        unbindDevice();
+        if (device->pendingBinds > 0)
+        {
+            lg2::info("Cancelling bind of fan EEPROM device with address "
+                      "{ADDRESS}",
+                      "ADDRESS", device->address);
+        }
+
+        device->generation++;
+
+        SysfsWorker::get().post(
+            [device = device]() { return unbindDevice(*device); }, nullptr);
     }
 
   private:
     /**
-     * @brief When the bind timer expires it will bind the device.
+     * @brief The device data shared with the worker thread, which
+     *        may outlive this object.
+     */
+    struct Device
+    {
+        Device(const std::string& address, const std::filesystem::path& path) :
+            address(address), path(path)
+        {}
+
+        /**
+         * @brief The address string with the i2c bus and address.
+         * Example: '32-0050'
+         */
+        const std::string address;
+
+        /**
+         * @brief The path to the driver dir, like
+         *        /sys/bus/i2c/drivers/at24
+         */
+        const std::filesystem::path path;
+
+        /** @brief Incremented on each unbind to cancel queued binds. */
+        std::atomic<uint64_t> generation{0};
+
+        /**
+         * @brief The number of binds queued and not completed.
+         *        Only used from the event loop.
+         */
+        size_t pendingBinds{0};
+    };
+
+    /**
+     * @brief When the bind timer expires it will queue the bind.
      */
-    void bindTimerExpired() const
+    void bindTimerExpired()
     {
-        unbindDevice();
+        auto generation = device->generation.load();
+        device->pendingBinds++;
+
+        SysfsWorker::get().post(
+            [device = device, generation]() {
+                // The fan was pulled again since this was queued.
+                if (device->generation != generation)
+                {
+                    return true;
+                }
+
+                unbindDevice(*device);
+                return bindDevice(*device);
+            },
+            [device = device](bool) { device->pendingBinds--; });
+    }
 
-        auto bindPath = path / "bind";
+    /**
+     * @brief Binds the device.  Runs on the worker thread.
+     */
+    static bool bindDevice(const Device& device)
+    {
+        auto bindPath = device.path / "bind";
         std::ofstream bind{bindPath};
         if (bind.good())
         {
             lg2::info("Binding fan EEPROM device with address {ADDRESS}",
-                      "ADDRESS", address);
-            bind << address;
+                      "ADDRESS", device.address);
+            bind << device.address;
         }
 
         if (bind.fail())
         {
             lg2::error("Error while binding fan EEPROM device with path {PATH}"
                        " and address {ADDR}",
-                       "PATH", bindPath, "ADDR", address);
+                       "PATH", bindPath, "ADDR", device.address);
+            return false;
         }
+
+        return true;
     }
 
     /**
-     * @brief Unbinds the device.
+     * @brief Unbinds the device.  Runs on the worker thread.
      */
-    void unbindDevice() const
+    static bool unbindDevice(const Device& device)
     {
-        auto devicePath = path / address;
+        auto devicePath = device.path / device.address;
         if (!std::filesystem::exists(devicePath))
         {
-            return;
+            return true;
         }
 
-        auto unbindPath = path / "unbind";
+        auto unbindPath = device.path / "unbind";
         std::ofstream unbind{unbindPath};
         if (unbind.good())
         {
-            unbind << address;
+            unbind << device.address;
         }
 
         if (unbind.fail())
         {
             lg2::error("Error while unbinding fan EEPROM device with path"
                        " {PATH} and address {ADDR}",
-                       "PATH", unbindPath, "ADDR", address);
+                       "PATH", unbindPath, "ADDR", device.address);
+            return false;
         }
+
+        return true;
     }
 
     /** @brief The base I2C drivers directory in sysfs */
     const std::filesystem::path baseDriverPath{"/sys/bus/i2c/drivers"};
 
-    /**
-     * @brief The address string with the i2c bus and address.
-     * Example: '32-0050'
-     */
-    const std::string address;
-
-    /** @brief The path to the driver dir, like /sys/bus/i2c/drivers/at24 */
-    const std::filesystem::path path;
+    /** @brief The device data */
+    const std::shared_ptr<Device> device;
 
     /** @brief Number of milliseconds to delay to actually do the bind. */
     const size_t bindDelay{};
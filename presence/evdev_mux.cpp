@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#include "evdev_mux.hpp"
+
+#include <fcntl.h>
+
+#include <phosphor-logging/lg2.hpp>
+#include <sdeventplus/event.hpp>
+
+#include <algorithm>
+#include <cerrno>
+
+namespace phosphor
+{
+namespace fan
+{
+namespace presence
+{
+
+using sdeventplus::source::Enabled;
+
+EvdevMultiplexer::EvdevMultiplexer(const std::string& device) :
+    device(device), evdevfd(open(device.c_str(), O_RDONLY | O_NONBLOCK)),
+    evdev(evdevpp::evdev::newFromFD(evdevfd()))
+{}
+
+std::shared_ptr<EvdevMultiplexer>
+    EvdevMultiplexer::get(const std::string& device)
+{
+    static std::map<std::string, std::weak_ptr<EvdevMultiplexer>> devices;
+
+    auto mux = devices[device].lock();
+    if (!mux)
+    {
+        mux = std::make_shared<EvdevMultiplexer>(device);
+        devices[device] = mux;
+    }
+
+    return mux;
+}
+
+void EvdevMultiplexer::add(unsigned int code, const void* owner,
+                           Callback&& callback)
+{
+    callbacks[code].emplace_back(owner, std::move(callback));
+
+    if (!source)
+    {
+        source.emplace(sdeventplus::Event::get_default(), evdevfd(), EPOLLIN,
+                       std::bind(&EvdevMultiplexer::ioCallback, this));
+    }
+    else
+    {
+        source->set_enabled(Enabled::On);
+    }
+}
+
+void EvdevMultiplexer::remove(const void* owner)
+{
+    for (auto it = callbacks.begin(); it != callbacks.end();)
+    {
+        std::erase_if(it->second,
+                      [owner](const auto& c) { return c.first == owner; });
+
+        if (it->second.empty())
+        {
+            it = callbacks.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    // Only disable the source, as this may be called from its callback.
+    if (callbacks.empty() && source)
+    {
+        source->set_enabled(Enabled::Off);
+    }
+}
+
+void EvdevMultiplexer::ioCallback()
+{
+    struct input_event ev;
+    unsigned int flags = LIBEVDEV_READ_FLAG_NORMAL;
+
+    // Read everything that is queued up.
+    while (true)
+    {
+        auto rc = evdev.nextEvent(flags, ev);
+
+        if (rc == -EAGAIN)
+        {
+            if (flags == LIBEVDEV_READ_FLAG_SYNC)
+            {
+                // Done resyncing, back to the normal events.
+                flags = LIBEVDEV_READ_FLAG_NORMAL;
+                continue;
+            }
+            break;
+        }
+
+        if (rc < 0)
+        {
+            lg2::error("Error reading events from {DEVICE}: {RC}", "DEVICE",
+                       device, "RC", rc);
+            break;
+        }
+
+        if ((rc == LIBEVDEV_READ_STATUS_SYNC) &&
+            (flags == LIBEVDEV_READ_FLAG_NORMAL))
+        {
+            // Events were dropped, so read the state
+            // changes that were missed instead.
+            lg2::info("Resyncing dropped events from {DEVICE}", "DEVICE",
+                      device);
+            flags = LIBEVDEV_READ_FLAG_SYNC;
+            continue;
+        }
+
+        if (ev.type != EV_KEY)
+        {
+            continue;
+        }
+
+        auto it = callbacks.find(ev.code);
+        if (it == callbacks.end())
+        {
+            continue;
+        }
+
+        // Copy them, as a callback may end up adding or removing callbacks.
+        auto keyCallbacks = it->second;
+        for (const auto& [owner, callback] : keyCallbacks)
+        {
+            callback(ev.value != 0);
+        }
+    }
+}
+
+} // namespace presence
+} // namespace fan
+} // namespace phosphor
@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include "evdevpp/evdev.hpp"
+#include "utility.hpp"
+
+#include <sdeventplus/source/io.hpp>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace phosphor
+{
+namespace fan
+{
+namespace presence
+{
+
+/**
+ * @class EvdevMultiplexer
+ * @brief Shares one gpio-keys input device between Gpio sensors.
+ *
+ * There is one EvdevMultiplexer per input device node, which opens the
+ * device once and has the only event source for it.  When the device is
+ * readable, every pending event is read and passed to the callbacks
+ * registered for the event's key code.  If the kernel dropped events
+ * because they weren't read fast enough, the key states are resynced
+ * so no pin's change is lost.
+ */
+class EvdevMultiplexer
+{
+  public:
+    /** @brief Called with the new state of a key. */
+    using Callback = std::function<void(bool)>;
+
+    EvdevMultiplexer() = delete;
+    EvdevMultiplexer(const EvdevMultiplexer&) = delete;
+    EvdevMultiplexer& operator=(const EvdevMultiplexer&) = delete;
+    EvdevMultiplexer(EvdevMultiplexer&&) = delete;
+    EvdevMultiplexer& operator=(EvdevMultiplexer&&) = delete;
+    ~EvdevMultiplexer() = default;
+
+    /**
+     * @brief Open the input device.
+     *
+     * Use get() instead, so that the device is shared.
+     *
+     * @param[in] device - The gpio-keys input device.
+     */
+    explicit EvdevMultiplexer(const std::string& device);
+
+    /**
+     * @brief Get the multiplexer for an input device, creating
+     *        it if it doesn't exist yet.
+     *
+     * @param[in] device - The gpio-keys input device.
+     */
+    static std::shared_ptr<EvdevMultiplexer> get(const std::string& device);
+
+    /**
+     * @brief Register a callback for the changes of a key.
+     *
+     * @param[in] code - The key code.
+     * @param[in] owner - Identifies the callback for remove().
+     * @param[in] callback - The callback.
+     */
+    void add(unsigned int code, const void* owner, Callback&& callback);
+
+    /**
+     * @brief Remove all of the callbacks of an owner.
+     *
+     * @param[in] owner - The owner passed to add().
+     */
+    void remove(const void* owner);
+
+    /**
+     * @brief Get the current state of a key.
+     *
+     * @param[in] code - The key code.
+     */
+    bool fetch(unsigned int code)
+    {
+        return evdev.fetch(EV_KEY, code) != 0;
+    }
+
+  private:
+    /** @brief sdevent io callback. */
+    void ioCallback();
+
+    /** @brief The input device path. */
+    std::string device;
+
+    /** @brief The input device file descriptor. */
+    util::FileDescriptor evdevfd;
+
+    /** @brief The input device. */
+    evdevpp::evdev::EvDev evdev;
+
+    /** @brief The callbacks and their owners by key code. */
+    std::map<unsigned int, std::vector<std::pair<const void*, Callback>>>
+        callbacks;
+
+    /** @brief sdevent io handle, enabled while there are callbacks. */
+    std::optional<sdeventplus::source::IO> source;
+};
+
+} // namespace presence
+} // namespace fan
+} // namespace phosphor
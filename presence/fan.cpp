@@ -15,11 +15,9 @@
  */
 #include "fan.hpp"
 
+#include "presence_publisher.hpp"
 #include "sdbusplus.hpp"
 
-#include <sdbusplus/message.hpp>
-
-#include <map>
 #include <string>
 
 namespace phosphor
@@ -32,26 +30,10 @@ namespace presence
 using namespace std::literals::string_literals;
 
 static const auto itemIface = "xyz.openbmc_project.Inventory.Item"s;
-static const auto invMgrIface = "xyz.openbmc_project.Inventory.Manager"s;
-static const auto fanIface = "xyz.openbmc_project.Inventory.Item.Fan"s;
 
 void setPresence(const Fan& fan, bool newState)
 {
-    using Properties = std::map<std::string, std::variant<std::string, bool>>;
-    using Interfaces = std::map<std::string, Properties>;
-
-    std::map<sdbusplus::object_path, Interfaces> obj = {{
-        std::get<1>(fan),
-        {{itemIface,
-          {
-              {"Present"s, newState},
-              {"PrettyName"s, std::get<0>(fan)},
-          }},
-         {fanIface, {}}},
-    }};
-
-    util::SDBusPlus::lookupAndCallMethod(invNamespace, invMgrIface, "Notify"s,
-                                         obj);
+    PresencePublisher::get().set(fan, newState);
 }
 
 bool getPresence(const Fan& fan)
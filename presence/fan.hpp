@@ -21,6 +21,8 @@ using Fan = std::tuple<std::string, std::string, std::optional<size_t>>;
  *
  * Update the Present property of the
  * xyz.openbmc_project.Inventory.Item interface.
+ * The update is queued with the PresencePublisher
+ * and sent on the next event loop iteration.
  *
  * @param[in] fan - The fan to update.
  * @param[in] newState - The new state of the fan.
@@ -21,12 +21,10 @@
 
 #include <phosphor-logging/elog-errors.hpp>
 #include <phosphor-logging/elog.hpp>
-#include <sdeventplus/event.hpp>
 #include <xyz/openbmc_project/Common/Callout/error.hpp>
 #include <xyz/openbmc_project/Logging/Entry/server.hpp>
 
 #include <functional>
-#include <tuple>
 
 namespace phosphor
 {
@@ -41,26 +39,31 @@ const auto loggingCreateIface = "xyz.openbmc_project.Logging.Create";
 
 Gpio::Gpio(const std::string& physDevice, const std::string& device,
            unsigned int physPin) :
-    currentState(false), evdevfd(open(device.c_str(), O_RDONLY | O_NONBLOCK)),
-    evdev(evdevpp::evdev::newFromFD(evdevfd())), phys(physDevice), pin(physPin)
+    currentState(false), mux(EvdevMultiplexer::get(device)), phys(physDevice),
+    pin(physPin)
 {}
 
+Gpio::~Gpio()
+{
+    mux->remove(this);
+}
+
 bool Gpio::start()
 {
-    source.emplace(sdeventplus::Event::get_default(), evdevfd(), EPOLLIN,
-                   std::bind(&Gpio::ioCallback, this));
+    mux->add(pin, this,
+             std::bind(&Gpio::keyChanged, this, std::placeholders::_1));
     currentState = present();
     return currentState;
 }
 
 void Gpio::stop()
 {
-    source.reset();
+    mux->remove(this);
 }
 
 bool Gpio::present()
 {
-    return evdev.fetch(EV_KEY, pin) != 0;
+    return mux->fetch(pin);
 }
 
 void Gpio::fail()
@@ -74,18 +77,8 @@ void Gpio::fail()
         GPIO::CALLOUT_DEVICE_PATH(phys.c_str()));
 }
 
-void Gpio::ioCallback()
+void Gpio::keyChanged(bool newState)
 {
-    unsigned int type, code, value;
-
-    std::tie(type, code, value) = evdev.next();
-    if (type != EV_KEY || code != pin)
-    {
-        return;
-    }
-
-    bool newState = value != 0;
-
     if (currentState != newState)
     {
         getPolicy().stateChanged(newState, *this);
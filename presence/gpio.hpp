@@ -1,12 +1,9 @@
 #pragma once
 
-#include "evdevpp/evdev.hpp"
+#include "evdev_mux.hpp"
 #include "psensor.hpp"
-#include "utility.hpp"
 
-#include <sdeventplus/source/io.hpp>
-
-#include <optional>
+#include <memory>
 
 namespace phosphor
 {
@@ -36,7 +33,7 @@ class Gpio : public PresenceSensor
     Gpio& operator=(const Gpio&) = delete;
     Gpio(Gpio&&) = delete;
     Gpio& operator=(Gpio&&) = delete;
-    ~Gpio() = default;
+    ~Gpio();
 
     /**
      * @brief Construct a gpio sensor.
@@ -51,7 +48,7 @@ class Gpio : public PresenceSensor
     /**
      * @brief start
      *
-     * Register for an sdevent io callback on the gpio.
+     * Register for the key events of the gpio.
      * Query the initial state of the gpio.
      *
      * @return The current sensor state.
@@ -61,7 +58,7 @@ class Gpio : public PresenceSensor
     /**
      * @brief stop
      *
-     * De-register sdevent io callback.
+     * De-register for the key events.
      */
     void stop() override;
 
@@ -90,26 +87,24 @@ class Gpio : public PresenceSensor
     /** @brief Get the policy associated with this sensor. */
     virtual RedundancyPolicy& getPolicy() = 0;
 
-    /** @brief sdevent io callback. */
-    void ioCallback();
+    /**
+     * @brief Key event callback.
+     *
+     * @param[in] newState - The new gpio state.
+     */
+    void keyChanged(bool newState);
 
     /** The current state of the sensor. */
     bool currentState;
 
-    /** Gpio event device file descriptor. */
-    util::FileDescriptor evdevfd;
-
-    /** Gpio event device. */
-    evdevpp::evdev::EvDev evdev;
+    /** Gpio event device, shared with the other pins on it. */
+    std::shared_ptr<EvdevMultiplexer> mux;
 
     /** Physical gpio device. */
     std::string phys;
 
     /** Gpio pin number. */
     unsigned int pin;
-
-    /** sdevent io handle. */
-    std::optional<sdeventplus::source::IO> source;
 };
 
 /**
@@ -269,8 +269,14 @@ std::unique_ptr<PresenceSensor> getTach(size_t fanIndex, const json& method)
         sensors.emplace_back(sensor.get<std::string>());
     }
 
+    std::optional<std::chrono::milliseconds> maxAge;
+    if (method.contains("max_age_ms"))
+    {
+        maxAge = std::chrono::milliseconds{method["max_age_ms"].get<size_t>()};
+    }
+
     return std::make_unique<PolicyAccess<Tach, JsonConfig>>(
-        fanIndex, std::move(sensors));
+        fanIndex, std::move(sensors), maxAge);
 }
 
 // Get a constructed presence sensor for fan presence detection by gpio
@@ -0,0 +1,175 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#include "presence_publisher.hpp"
+
+#include "sdbusplus.hpp"
+
+#include <phosphor-logging/lg2.hpp>
+#include <sdeventplus/event.hpp>
+
+#include <algorithm>
+#include <system_error>
+
+namespace phosphor
+{
+namespace fan
+{
+namespace presence
+{
+
+using namespace std::literals::string_literals;
+using sdeventplus::source::Enabled;
+
+static const auto itemIface = "xyz.openbmc_project.Inventory.Item"s;
+static const auto invMgrIface = "xyz.openbmc_project.Inventory.Manager"s;
+static const auto fanIface = "xyz.openbmc_project.Inventory.Item.Fan"s;
+
+constexpr std::chrono::seconds minRetryDelay{1};
+constexpr std::chrono::seconds maxRetryDelay{60};
+
+PresencePublisher& PresencePublisher::get()
+{
+    static PresencePublisher publisher;
+    return publisher;
+}
+
+PresencePublisher::PresencePublisher() :
+    defer(sdeventplus::Event::get_default(),
+          [this](sdeventplus::source::EventBase&) { publish(); }),
+    retryTimer(sdeventplus::Event::get_default(), [this](auto&) { publish(); }),
+    retryDelay(minRetryDelay)
+{
+    defer.set_enabled(Enabled::Off);
+}
+
+void PresencePublisher::set(const Fan& fan, bool present)
+{
+    sdbusplus::object_path path{std::get<1>(fan)};
+
+    // Send what is waiting first so this fan's previous change isn't
+    // overwritten, unless that has to wait for the call being made.
+    if (pending.contains(path) && inFlight.empty())
+    {
+        publish();
+    }
+
+    pending[path] = {{itemIface,
+                      {
+                          {"Present"s, present},
+                          {"PrettyName"s, std::get<0>(fan)},
+                      }},
+                     {fanIface, {}}};
+
+    if (!firstQueued)
+    {
+        firstQueued = Clock::now();
+    }
+
+    defer.set_enabled(Enabled::OneShot);
+}
+
+void PresencePublisher::publish()
+{
+    defer.set_enabled(Enabled::Off);
+
+    // What is queued now goes out when the outstanding call completes
+    if (pending.empty() || !inFlight.empty())
+    {
+        return;
+    }
+
+    auto& bus = util::SDBusPlus::getBus();
+
+    try
+    {
+        if (service.empty())
+        {
+            service = util::SDBusPlus::getService(bus, invNamespace,
+                                                  invMgrIface);
+        }
+
+        auto msg = bus.new_method_call(service.c_str(), invNamespace.c_str(),
+                                       invMgrIface.c_str(), "Notify");
+        msg.append(pending);
+
+        // A null slot makes it a floating call, which sd-bus cleans
+        // up by itself after the reply arrives.
+        auto rc = sd_bus_call_async(bus.get(), nullptr, msg.get(),
+                                    &PresencePublisher::notified, this, 0);
+        if (rc < 0)
+        {
+            throw std::system_error{-rc, std::generic_category(),
+                                    "sd_bus_call_async"};
+        }
+
+        if (firstCount == 0)
+        {
+            firstCount = pending.size();
+        }
+
+        inFlight = std::move(pending);
+        pending.clear();
+    }
+    catch (const std::exception& e)
+    {
+        // The service may have been restarted with a new name.
+        service.clear();
+        lg2::error("Failed calling Notify for {COUNT} fans: {ERROR}", "COUNT",
+                   pending.size(), "ERROR", e);
+        retry();
+    }
+}
+
+void PresencePublisher::retry()
+{
+    // Anything queued since the call was made is newer, so it wins
+    pending.merge(inFlight);
+    inFlight.clear();
+
+    retryTimer.restartOnce(retryDelay);
+    retryDelay = std::min(retryDelay * 2, maxRetryDelay);
+}
+
+int PresencePublisher::notified(sd_bus_message* reply, void* userData,
+                                sd_bus_error* /*error*/)
+{
+    auto* publisher = static_cast<PresencePublisher*>(userData);
+
+    if (sd_bus_message_is_method_error(reply, nullptr))
+    {
+        const auto* error = sd_bus_message_get_error(reply);
+        lg2::error("Inventory Notify call for {COUNT} fans failed: {ERROR}",
+                   "COUNT", publisher->inFlight.size(), "ERROR",
+                   (error && error->message) ? error->message : "unknown");
+        publisher->service.clear();
+        publisher->retry();
+        return 0;
+    }
+
+    publisher->inFlight.clear();
+    publisher->retryDelay = minRetryDelay;
+
+    // Send what was queued while the call was outstanding
+    if (!publisher->pending.empty() && !publisher->retryTimer.isEnabled())
+    {
+        publisher->defer.set_enabled(Enabled::OneShot);
+    }
+
+    // Record how long it took from the first presence
+    // update at startup to it being in the inventory.
+    if (!publisher->firstPublished && publisher->firstQueued)
+    {
+        auto time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            Clock::now() - *publisher->firstQueued);
+        lg2::info("Initial presence of {COUNT} fans published in {TIME}ms",
+                  "COUNT", publisher->firstCount, "TIME", time.count());
+        publisher->firstPublished = true;
+    }
+
+    return 0;
+}
+
+} // namespace presence
+} // namespace fan
+} // namespace phosphor
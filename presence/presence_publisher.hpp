@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include "fan.hpp"
+
+#include <systemd/sd-bus.h>
+
+#include <sdbusplus/message.hpp>
+#include <sdeventplus/clock.hpp>
+#include <sdeventplus/source/event.hpp>
+#include <sdeventplus/utility/timer.hpp>
+
+#include <chrono>
+#include <map>
+#include <optional>
+#include <string>
+#include <variant>
+
+namespace phosphor
+{
+namespace fan
+{
+namespace presence
+{
+
+/**
+ * @class PresencePublisher
+ * @brief Batches the fan presence updates to the inventory.
+ *
+ * The presence changes made while handling one event, such as every
+ * fan's policy running its initial check at startup, are collected and
+ * sent together with one asynchronous Notify call to the inventory
+ * manager from a deferred event source.
+ *
+ * If a fan already has a change waiting, the waiting changes are sent
+ * first so that the inventory still sees every change of each fan in
+ * order.
+ *
+ * Only one call is outstanding at a time.  If it fails, its updates
+ * are put back under any newer ones queued since, and are sent again
+ * after a backoff, so the inventory doesn't stay wrong until the fan
+ * changes again.
+ */
+class PresencePublisher
+{
+  public:
+    PresencePublisher(const PresencePublisher&) = delete;
+    PresencePublisher& operator=(const PresencePublisher&) = delete;
+    PresencePublisher(PresencePublisher&&) = delete;
+    PresencePublisher& operator=(PresencePublisher&&) = delete;
+    ~PresencePublisher() = default;
+
+    /**
+     * @brief Get the single PresencePublisher object.
+     */
+    static PresencePublisher& get();
+
+    /**
+     * @brief Queue a fan presence update.
+     *
+     * @param[in] fan - The fan to update.
+     * @param[in] present - The new state of the fan.
+     */
+    void set(const Fan& fan, bool present);
+
+  private:
+    using Properties = std::map<std::string, std::variant<std::string, bool>>;
+    using Interfaces = std::map<std::string, Properties>;
+    using ObjectMap = std::map<sdbusplus::object_path, Interfaces>;
+    using Clock = std::chrono::steady_clock;
+
+    PresencePublisher();
+
+    /**
+     * @brief Send the queued updates with one Notify call.
+     */
+    void publish();
+
+    /**
+     * @brief The sd-bus reply handler for the Notify calls.
+     */
+    static int notified(sd_bus_message* reply, void* userData,
+                        sd_bus_error* error);
+
+    /**
+     * @brief Puts the updates of a failed call back in the queue,
+     *        unless newer ones were queued, and schedules a retry.
+     */
+    void retry();
+
+    /** @brief The queued updates. */
+    ObjectMap pending;
+
+    /** @brief The updates in the outstanding Notify call. */
+    ObjectMap inFlight;
+
+    /** @brief Runs publish() on the next event loop iteration. */
+    sdeventplus::source::Defer defer;
+
+    /** @brief Runs publish() after a failed call. */
+    sdeventplus::utility::Timer<sdeventplus::ClockId::Monotonic> retryTimer;
+
+    /** @brief The time until the next retry, doubled on each failure. */
+    std::chrono::seconds retryDelay;
+
+    /** @brief The inventory manager service name. */
+    std::string service;
+
+    /** @brief When the first update after startup was queued. */
+    std::optional<Clock::time_point> firstQueued;
+
+    /** @brief The number of fans in the first Notify call. */
+    size_t firstCount = 0;
+
+    /** @brief If the first publish after startup has completed. */
+    bool firstPublished = false;
+};
+
+} // namespace presence
+} // namespace fan
+} // namespace phosphor
@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#include "sysfs_worker.hpp"
+
+#include "sdeventplus.hpp"
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <cerrno>
+#include <system_error>
+
+namespace phosphor::fan::presence
+{
+
+using namespace phosphor::fan::util;
+
+SysfsWorker& SysfsWorker::get()
+{
+    static SysfsWorker worker;
+    return worker;
+}
+
+SysfsWorker::SysfsWorker() : eventFd(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+{
+    if (eventFd < 0)
+    {
+        throw std::system_error{errno, std::generic_category(),
+                                "Could not create sysfs worker eventfd"};
+    }
+
+    source.emplace(SDEventPlus::getEvent(), eventFd, EPOLLIN,
+                   [this](auto&, auto, auto) { completed(); });
+
+    thread = std::thread{&SysfsWorker::run, this};
+}
+
+SysfsWorker::~SysfsWorker()
+{
+    {
+        std::lock_guard lock{mutex};
+        stopping = true;
+    }
+    cv.notify_one();
+    thread.join();
+
+    source.reset();
+    close(eventFd);
+}
+
+void SysfsWorker::post(Work&& work, Done&& done)
+{
+    {
+        std::lock_guard lock{mutex};
+        jobs.emplace_back(std::move(work), std::move(done));
+    }
+    cv.notify_one();
+}
+
+void SysfsWorker::run()
+{
+    while (true)
+    {
+        std::pair<Work, Done> job;
+
+        {
+            std::unique_lock lock{mutex};
+            cv.wait(lock, [this] { return stopping || !jobs.empty(); });
+
+            if (stopping)
+            {
+                return;
+            }
+
+            job = std::move(jobs.front());
+            jobs.pop_front();
+        }
+
+        bool result = job.first();
+
+        {
+            std::lock_guard lock{mutex};
+            results.emplace_back(std::move(job.second), result);
+        }
+
+        uint64_t one = 1;
+        if (write(eventFd, &one, sizeof(one)) != sizeof(one))
+        {
+            lg2::error("Could not signal sysfs work completion: {ERRNO}",
+                       "ERRNO", errno);
+        }
+    }
+}
+
+void SysfsWorker::completed()
+{
+    uint64_t count;
+    if (read(eventFd, &count, sizeof(count)) < 0)
+    {
+        return;
+    }
+
+    std::deque<std::pair<Done, bool>> done;
+    {
+        std::lock_guard lock{mutex};
+        done.swap(results);
+    }
+
+    for (auto& [callback, result] : done)
+    {
+        if (callback)
+        {
+            callback(result);
+        }
+    }
+}
+
+} // namespace phosphor::fan::presence
@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include <sdeventplus/source/io.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+
+namespace phosphor::fan::presence
+{
+
+/**
+ * @class SysfsWorker
+ *
+ * Runs sysfs writes that can block, like the EEPROM driver bind and
+ * unbind writes that wait for the driver to probe the device over a
+ * slow I2C bus, on a worker thread so that the event loop can keep
+ * handling presence events.
+ *
+ * Work items run one at a time in the order they were posted.  When
+ * one finishes its completion callback is run from the event loop,
+ * which the worker wakes up with an eventfd.
+ */
+class SysfsWorker
+{
+  public:
+    /** @brief Runs on the worker thread, returning if it worked. */
+    using Work = std::function<bool()>;
+
+    /** @brief Runs in the event loop with the result of the work. */
+    using Done = std::function<void(bool)>;
+
+    SysfsWorker(const SysfsWorker&) = delete;
+    SysfsWorker& operator=(const SysfsWorker&) = delete;
+    SysfsWorker(SysfsWorker&&) = delete;
+    SysfsWorker& operator=(SysfsWorker&&) = delete;
+
+    /**
+     * @brief Stops and joins the worker thread
+     */
+    ~SysfsWorker();
+
+    /**
+     * @brief Get the single SysfsWorker object.
+     */
+    static SysfsWorker& get();
+
+    /**
+     * @brief Queue work for the worker thread.
+     *
+     * @param[in] work - The work to do on the worker thread
+     * @param[in] done - Called from the event loop when it's done
+     */
+    void post(Work&& work, Done&& done);
+
+  private:
+    SysfsWorker();
+
+    /**
+     * @brief The worker thread function
+     */
+    void run();
+
+    /**
+     * @brief The eventfd handler that runs the completion callbacks.
+     */
+    void completed();
+
+    /** @brief Protects jobs, results, and stopping. */
+    std::mutex mutex;
+
+    /** @brief Signals the worker thread there is work or it should stop. */
+    std::condition_variable cv;
+
+    /** @brief The work waiting for the worker thread. */
+    std::deque<std::pair<Work, Done>> jobs;
+
+    /** @brief The completions waiting for the event loop. */
+    std::deque<std::pair<Done, bool>> results;
+
+    /** @brief Tells the worker thread to exit. */
+    bool stopping = false;
+
+    /** @brief The eventfd the worker uses to wake the event loop. */
+    int eventFd;
+
+    /** @brief The event source for eventFd. */
+    std::optional<sdeventplus::source::IO> source;
+
+    /** @brief The worker thread. */
+    std::thread thread;
+};
+
+} // namespace phosphor::fan::presence
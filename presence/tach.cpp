@@ -17,6 +17,7 @@
 
 #include "logging.hpp"
 #include "rpolicy.hpp"
+#include "tach_signals.hpp"
 
 #include <phosphor-logging/lg2.hpp>
 
@@ -38,82 +39,109 @@ static const auto tachNamespace = "/xyz/openbmc_project/sensors/fan_tach/"s;
 static const auto tachIface = "xyz.openbmc_project.Sensor.Value"s;
 static const auto tachProperty = "Value"s;
 
-Tach::Tach(const std::vector<std::string>& sensors) : currentState(false)
+Tach::Tach(const std::vector<std::string>& sensors,
+           std::optional<std::chrono::milliseconds> maxAge) :
+    maxAge(maxAge), currentState(false)
 {
     // Initialize state.
     for (const auto& s : sensors)
     {
-        state.emplace_back(s, nullptr, 0);
+        state.emplace_back(s, 0, Clock::time_point{});
     }
 }
 
-bool Tach::start()
+Tach::~Tach()
 {
-    for (size_t i = 0; i < state.size(); ++i)
+    if (subscribed)
     {
-        auto& s = state[i];
-        auto tachPath = tachNamespace + std::get<std::string>(s);
-
-        // Register for signal callbacks.
-        std::get<1>(s) = std::make_unique<sdbusplus::match>(
-            util::SDBusPlus::getBus(),
-            sdbusplus::match_rules::propertiesChanged(tachPath, tachIface),
-            [this, i](auto& msg) { this->propertiesChanged(i, msg); });
-
-        // Get an initial tach speed.
-        try
-        {
-            std::get<double>(s) = util::SDBusPlus::getProperty<double>(
-                tachPath, tachIface, tachProperty);
-        }
-        catch (const std::exception&)
-        {
-            // Assume not spinning.
-
-            std::get<double>(s) = 0;
-            lg2::info("Unable to read fan tach sensor {TACPATH}", "TACPATH",
-                      tachPath);
-        }
+        TachSignals::get().remove(this);
     }
+}
+
+bool Tach::start()
+{
+    subscribe();
+    refresh(false);
 
     // Set the initial state of the sensor.
     currentState = std::any_of(state.begin(), state.end(), [](const auto& s) {
         return std::get<double>(s) != 0;
     });
+    started = true;
 
     return currentState;
 }
 
 void Tach::stop()
 {
-    for (auto& s : state)
-    {
-        // De-register signal callbacks.
-        std::get<1>(s) = nullptr;
-    }
+    // Keep the subscription, as a Fallback policy
+    // still calls present() on stopped sensors.
+    started = false;
 }
 
 bool Tach::present()
 {
-    // Live query the tach readings.
-    std::vector<double> values;
-    for (const auto& s : state)
+    subscribe();
+    refresh(true);
+
+    return std::any_of(state.begin(), state.end(), [](const auto& s) {
+        return std::get<double>(s) != 0;
+    });
+}
+
+void Tach::subscribe()
+{
+    if (subscribed)
     {
-        values.push_back(util::SDBusPlus::getProperty<double>(
-            tachNamespace + std::get<std::string>(s), tachIface, tachProperty));
+        return;
     }
 
-    return std::any_of(values.begin(), values.end(),
-                       [](const auto& v) { return v != 0; });
+    for (size_t i = 0; i < state.size(); ++i)
+    {
+        TachSignals::get().add(tachNamespace + std::get<std::string>(state[i]),
+                               this, [this, i](const auto& props) {
+                                   this->propertiesChanged(i, props);
+                               });
+    }
+
+    subscribed = true;
 }
 
-void Tach::propertiesChanged(size_t sensor, sdbusplus::message_t& msg)
+void Tach::refresh(bool throwOnError)
 {
-    std::string iface;
-    util::Properties<double> properties;
-    msg.read(iface, properties);
+    auto now = Clock::now();
+
+    for (auto& s : state)
+    {
+        auto& updated = std::get<Clock::time_point>(s);
+        if ((updated != Clock::time_point{}) &&
+            (!maxAge || (now - updated <= *maxAge)))
+        {
+            continue;
+        }
 
-    propertiesChanged(sensor, properties);
+        auto tachPath = tachNamespace + std::get<std::string>(s);
+        try
+        {
+            std::get<double>(s) = util::SDBusPlus::getProperty<double>(
+                tachPath, tachIface, tachProperty);
+        }
+        catch (const std::exception&)
+        {
+            if (throwOnError)
+            {
+                throw;
+            }
+
+            // Keep the previous speed, which is 0 (not spinning) if
+            // there never was one, and try again next time.
+            lg2::info("Unable to read fan tach sensor {TACPATH}", "TACPATH",
+                      tachPath);
+            continue;
+        }
+
+        updated = now;
+    }
 }
 
 void Tach::propertiesChanged(size_t sensor,
@@ -125,6 +153,12 @@ void Tach::propertiesChanged(size_t sensor,
     {
         auto& s = state[sensor];
         std::get<double>(s) = std::get<double>(it->second);
+        std::get<Clock::time_point>(s) = Clock::now();
+
+        if (!started)
+        {
+            return;
+        }
 
         auto newState =
             std::any_of(state.begin(), state.end(),
@@ -3,10 +3,10 @@
 #include "psensor.hpp"
 #include "sdbusplus.hpp"
 
-#include <sdbusplus/bus/match.hpp>
-#include <sdbusplus/message.hpp>
-
+#include <chrono>
+#include <optional>
 #include <string>
+#include <tuple>
 #include <vector>
 
 namespace phosphor
@@ -23,6 +23,12 @@ class RedundancyPolicy;
  *
  * The Tach class uses one or more tach speed indicators
  * to determine presence state.
+ *
+ * The tach speeds are cached from the PropertiesChanged signals
+ * delivered by the shared TachSignals subscription, so checking
+ * presence doesn't need to read them from D-Bus.  They are only
+ * read on first use and, if a maximum age is configured, when
+ * they haven't changed in that long.
  */
 class Tach : public PresenceSensor
 {
@@ -38,14 +44,19 @@ class Tach : public PresenceSensor
     Tach& operator=(const Tach&) = delete;
     Tach(Tach&&) = delete;
     Tach& operator=(Tach&&) = delete;
-    ~Tach() = default;
+    ~Tach();
 
     /**
      * @brief ctor
      *
      * @param[in] sensors - Fan tach sensors for this psensor.
+     * @param[in] maxAge - How long a cached tach speed can go
+     *                     without an update before present()
+     *                     reads it again, if at all.
      */
-    Tach(const std::vector<std::string>& sensors);
+    explicit Tach(
+        const std::vector<std::string>& sensors,
+        std::optional<std::chrono::milliseconds> maxAge = std::nullopt);
 
     /**
      * @brief start
@@ -60,14 +71,16 @@ class Tach : public PresenceSensor
     /**
      * @brief stop
      *
-     * De-register dbus signal callbacks.
+     * Stop reporting state changes to the policy.  The tach
+     * speeds are still cached for present().
      */
     void stop() override;
 
     /**
      * @brief Check the sensor.
      *
-     * Query the tach speeds.
+     * Uses the cached tach speeds, and throws if one that has
+     * to be read again can't be, like the live query did.
      */
     bool present() override;
 
@@ -94,17 +107,35 @@ class Tach : public PresenceSensor
         size_t sensor, const phosphor::fan::util::Properties<double>& props);
 
     /**
-     * @brief Properties changed handler for tach sensor updates.
+     * @brief Register for the tach sensor updates, if not already.
+     */
+    void subscribe();
+
+    /**
+     * @brief Read the tach speeds that were never read or
+     *        are older than maxAge.
      *
-     * @param[in] sensor - The sensor that changed.
-     * @param[in] msg - The sdbusplus signal message.
+     * A speed that fails to be read keeps its previous value and
+     * age, so it is read again the next time.
+     *
+     * @param[in] throwOnError - If a failed read should throw
+     *                           instead of being logged.
      */
-    void propertiesChanged(size_t sensor, sdbusplus::message_t& msg);
+    void refresh(bool throwOnError);
+
+    using Clock = std::chrono::steady_clock;
+
+    /** @brief array of tach sensors, tach values, and update times. */
+    std::vector<std::tuple<std::string, double, Clock::time_point>> state;
+
+    /** @brief The maximum age of a cached tach value. */
+    std::optional<std::chrono::milliseconds> maxAge;
+
+    /** @brief If the tach sensor updates are registered for. */
+    bool subscribed = false;
 
-    /** @brief array of tach sensors dbus matches, and tach values. */
-    std::vector<
-        std::tuple<std::string, std::unique_ptr<sdbusplus::match>, double>>
-        state;
+    /** @brief If the sensor is started. */
+    bool started = false;
 
     /** The current state of the sensor. */
     bool currentState;
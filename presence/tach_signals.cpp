@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#include "tach_signals.hpp"
+
+#include <algorithm>
+
+namespace phosphor
+{
+namespace fan
+{
+namespace presence
+{
+
+using namespace std::literals::string_literals;
+
+static const auto tachNamespace = "/xyz/openbmc_project/sensors/fan_tach"s;
+static const auto tachIface = "xyz.openbmc_project.Sensor.Value"s;
+
+TachSignals& TachSignals::get()
+{
+    static TachSignals signals;
+    return signals;
+}
+
+void TachSignals::add(const std::string& sensorPath, const void* owner,
+                      Callback&& callback)
+{
+    callbacks[sensorPath].emplace_back(owner, std::move(callback));
+
+    if (!match)
+    {
+        match = std::make_unique<sdbusplus::match>(
+            util::SDBusPlus::getBus(),
+            "type='signal',interface='org.freedesktop.DBus.Properties',"
+            "member='PropertiesChanged',path_namespace='" +
+                tachNamespace + "',arg0='" + tachIface + "'",
+            [this](auto& msg) { this->propertiesChanged(msg); });
+    }
+}
+
+void TachSignals::remove(const void* owner)
+{
+    for (auto it = callbacks.begin(); it != callbacks.end();)
+    {
+        std::erase_if(it->second,
+                      [owner](const auto& c) { return c.first == owner; });
+
+        if (it->second.empty())
+        {
+            it = callbacks.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    if (callbacks.empty())
+    {
+        match.reset();
+    }
+}
+
+void TachSignals::propertiesChanged(sdbusplus::message_t& msg)
+{
+    auto it = callbacks.find(msg.get_path());
+    if (it == callbacks.end())
+    {
+        return;
+    }
+
+    std::string iface;
+    util::Properties<double> properties;
+    msg.read(iface, properties);
+
+    // Copy them, as a callback may end up adding or removing callbacks.
+    auto sensorCallbacks = it->second;
+    for (const auto& [owner, callback] : sensorCallbacks)
+    {
+        callback(properties);
+    }
+}
+
+} // namespace presence
+} // namespace fan
+} // namespace phosphor
@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include "sdbusplus.hpp"
+
+#include <sdbusplus/bus/match.hpp>
+#include <sdbusplus/message.hpp>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace phosphor
+{
+namespace fan
+{
+namespace presence
+{
+
+/**
+ * @class TachSignals
+ * @brief One fan tach sensor subscription shared by all Tach sensors.
+ *
+ * Instead of each Tach sensor having a PropertiesChanged match per
+ * tach sensor, there is a single match on the fan_tach namespace whose
+ * signals are passed to the callbacks registered for the sensor path.
+ * The match only exists while there are callbacks registered.
+ */
+class TachSignals
+{
+  public:
+    /** @brief Called with the changed properties of a tach sensor. */
+    using Callback = std::function<void(const util::Properties<double>&)>;
+
+    TachSignals(const TachSignals&) = delete;
+    TachSignals& operator=(const TachSignals&) = delete;
+    TachSignals(TachSignals&&) = delete;
+    TachSignals& operator=(TachSignals&&) = delete;
+    ~TachSignals() = default;
+
+    /**
+     * @brief Get the single TachSignals object.
+     */
+    static TachSignals& get();
+
+    /**
+     * @brief Register a callback for the value changes of a tach sensor.
+     *
+     * @param[in] sensorPath - The tach sensor object path.
+     * @param[in] owner - Identifies the callback for remove().
+     * @param[in] callback - The callback.
+     */
+    void add(const std::string& sensorPath, const void* owner,
+             Callback&& callback);
+
+    /**
+     * @brief Remove all of the callbacks of an owner.
+     *
+     * @param[in] owner - The owner passed to add().
+     */
+    void remove(const void* owner);
+
+  private:
+    TachSignals() = default;
+
+    /**
+     * @brief The PropertiesChanged handler for all tach sensors.
+     *
+     * @param[in] msg - The sdbusplus signal message.
+     */
+    void propertiesChanged(sdbusplus::message_t& msg);
+
+    /** @brief The callbacks and their owners by sensor path. */
+    std::map<std::string, std::vector<std::pair<const void*, Callback>>>
+        callbacks;
+
+    /** @brief The match on the fan_tach namespace. */
+    std::unique_ptr<sdbusplus::match> match;
+};
+
+} // namespace presence
+} // namespace fan
+} // namespace phosphor
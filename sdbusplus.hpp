@@ -1,5 +1,7 @@
 #pragma once
 
+#include "metrics.hpp"
+
 #include <phosphor-logging/elog-errors.hpp>
 #include <phosphor-logging/elog.hpp>
 #include <phosphor-logging/lg2.hpp>
@@ -128,6 +130,7 @@ class SDBusPlus
         reqMsg.append(std::forward<Args>(args)...);
         try
         {
+            ActivityTimer timer{Activity::dbusCall};
             auto respMsg = bus.call(reqMsg);
             return respMsg;
         }
@@ -387,6 +390,7 @@ class SDBusPlus
         auto reqMsg = bus.new_method_call(busName.c_str(), path.c_str(),
                                           interface.c_str(), method.c_str());
         reqMsg.append(std::forward<Args>(args)...);
+        ActivityTimer timer{Activity::dbusCall};
         auto respMsg = bus.call(reqMsg);
 
         return respMsg;
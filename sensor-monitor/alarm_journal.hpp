@@ -0,0 +1,407 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include "types.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace sensor::monitor
+{
+
+/**
+ * @class AlarmJournal
+ *
+ * Persists the AlarmTimestamps map as an append-only binary journal, so
+ * each change only writes one small record instead of the whole map.
+ *
+ * The file starts with a magic/version header followed by records of:
+ *   uint32_t size - of the payload
+ *   payload       - uint8_t op, uint8_t shutdownType, uint8_t alarmType,
+ *                   uint64_t timestamp, then the sensor path
+ *   uint32_t hash - FNV-1a of the payload
+ *
+ * Replaying the records in order rebuilds the map.  A torn or corrupt
+ * record at the end, as left behind by a power loss during a write,
+ * ends the replay.
+ *
+ * After a number of appends, or whenever the caller asks, the journal
+ * is compacted by writing just the current entries to a temporary file
+ * that is synced and then renamed over the journal, so a crash leaves
+ * either the old or the new file in place and never a partial one.
+ */
+class AlarmJournal
+{
+  public:
+    AlarmJournal() = delete;
+    ~AlarmJournal() = default;
+    AlarmJournal(const AlarmJournal&) = delete;
+    AlarmJournal& operator=(const AlarmJournal&) = delete;
+    AlarmJournal(AlarmJournal&&) = delete;
+    AlarmJournal& operator=(AlarmJournal&&) = delete;
+
+    /**
+     * @brief Constructor
+     *
+     * @param[in] path - The journal file path
+     * @param[in] compactAfter - How many appends trigger a compaction
+     */
+    explicit AlarmJournal(const std::filesystem::path& path,
+                          size_t compactAfter = 64) :
+        _path(path), _compactAfter(compactAfter)
+    {}
+
+    /**
+     * @brief Reads the journal and returns the map it describes.
+     *
+     * If the journal had a bad record it is compacted so that new
+     * records aren't appended after it.
+     *
+     * @return std::map<AlarmKey, uint64_t> - The timestamps
+     */
+    std::map<AlarmKey, uint64_t> replay()
+    {
+        std::map<AlarmKey, uint64_t> timestamps;
+        _appended = 0;
+
+        std::ifstream stream{_path, std::ios::binary};
+        if (!stream)
+        {
+            return timestamps;
+        }
+
+        std::vector<uint8_t> data{std::istreambuf_iterator<char>{stream},
+                                  std::istreambuf_iterator<char>{}};
+
+        if ((data.size() < magic.size()) ||
+            !std::equal(magic.begin(), magic.end(), data.begin()))
+        {
+            lg2::error("Invalid alarm timestamp journal {PATH}, discarding",
+                       "PATH", _path);
+            compact(timestamps);
+            return timestamps;
+        }
+
+        size_t pos = magic.size();
+        while (pos < data.size())
+        {
+            auto size = read<uint32_t>(data, pos);
+            if (!size || (*size < fixedPayloadSize) ||
+                (data.size() - pos < sizeof(uint32_t) * 2 + *size))
+            {
+                break;
+            }
+
+            const uint8_t* payload = data.data() + pos + sizeof(uint32_t);
+            auto hash = read<uint32_t>(data, pos + sizeof(uint32_t) + *size);
+            if (*hash != fnv1a(payload, *size))
+            {
+                break;
+            }
+
+            apply(payload, *size, timestamps);
+            pos += sizeof(uint32_t) * 2 + *size;
+            _appended++;
+        }
+
+        if (pos != data.size())
+        {
+            lg2::error("Alarm timestamp journal {PATH} has a bad record at "
+                       "offset {OFFSET}, discarding the rest",
+                       "PATH", _path, "OFFSET", pos);
+            compact(timestamps);
+        }
+
+        return timestamps;
+    }
+
+    /**
+     * @brief Appends the record for an added entry.
+     *
+     * @param[in] key - The AlarmKey
+     * @param[in] timestamp - The timestamp
+     */
+    void add(const AlarmKey& key, uint64_t timestamp)
+    {
+        append(Op::add, key, timestamp);
+    }
+
+    /**
+     * @brief Appends the record for an erased entry.
+     *
+     * @param[in] key - The AlarmKey
+     */
+    void erase(const AlarmKey& key)
+    {
+        append(Op::erase, key, 0);
+    }
+
+    /**
+     * @brief Says if enough records were appended since the
+     *        last compaction that it should be done again.
+     */
+    bool needsCompaction() const
+    {
+        return _appended >= _compactAfter;
+    }
+
+    /**
+     * @brief Atomically replaces the journal with one that only
+     *        has the entries passed in.
+     *
+     * @param[in] timestamps - The current timestamps
+     */
+    void compact(const std::map<AlarmKey, uint64_t>& timestamps)
+    {
+        std::vector<uint8_t> data{magic.begin(), magic.end()};
+        for (const auto& [key, timestamp] : timestamps)
+        {
+            encode(Op::add, key, timestamp, data);
+        }
+
+        auto tmpPath = _path;
+        tmpPath += ".tmp";
+
+        createParentDir();
+
+        int fd = open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+                      0644);
+        if (fd < 0)
+        {
+            lg2::error("Could not create {PATH}: {ERRNO}", "PATH", tmpPath,
+                       "ERRNO", errno);
+            return;
+        }
+
+        bool ok = writeAll(fd, data) && (fsync(fd) == 0);
+        close(fd);
+
+        if (!ok || (rename(tmpPath.c_str(), _path.c_str()) != 0))
+        {
+            lg2::error("Could not write alarm timestamp journal {PATH}: "
+                       "{ERRNO}",
+                       "PATH", _path, "ERRNO", errno);
+            std::error_code ec;
+            std::filesystem::remove(tmpPath, ec);
+            return;
+        }
+
+        // Make the rename itself durable
+        int dirFd = open(_path.parent_path().c_str(),
+                         O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (dirFd >= 0)
+        {
+            fsync(dirFd);
+            close(dirFd);
+        }
+
+        _appended = 0;
+    }
+
+    /**
+     * @brief Returns the journal file path
+     */
+    const std::filesystem::path& path() const
+    {
+        return _path;
+    }
+
+  private:
+    /**
+     * @brief The record operations
+     */
+    enum class Op : uint8_t
+    {
+        add = 1,
+        erase = 2
+    };
+
+    static constexpr std::array<uint8_t, 8> magic{'S', 'M', 'A', 'T',
+                                                  'J', 'R', 'N', '1'};
+
+    static constexpr size_t fixedPayloadSize = 3 + sizeof(uint64_t);
+
+    /**
+     * @brief 32 bit FNV-1a hash
+     */
+    static uint32_t fnv1a(const uint8_t* data, size_t size)
+    {
+        uint32_t hash = 2166136261u;
+        for (size_t i = 0; i < size; i++)
+        {
+            hash ^= data[i];
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    /**
+     * @brief Reads a T from data at pos, if there is room for it.
+     */
+    template <typename T>
+    static std::optional<T> read(const std::vector<uint8_t>& data, size_t pos)
+    {
+        if ((pos > data.size()) || (data.size() - pos < sizeof(T)))
+        {
+            return std::nullopt;
+        }
+
+        T value;
+        std::memcpy(&value, data.data() + pos, sizeof(T));
+        return value;
+    }
+
+    /**
+     * @brief Appends the raw bytes of a value to data.
+     */
+    template <typename T>
+    static void write(T value, std::vector<uint8_t>& data)
+    {
+        auto bytes = reinterpret_cast<const uint8_t*>(&value);
+        data.insert(data.end(), bytes, bytes + sizeof(T));
+    }
+
+    /**
+     * @brief Appends a full record to data.
+     */
+    static void encode(Op op, const AlarmKey& key, uint64_t timestamp,
+                       std::vector<uint8_t>& data)
+    {
+        const auto& [sensorPath, shutdownType, alarmType] = key;
+
+        uint32_t size = fixedPayloadSize + sensorPath.size();
+        write(size, data);
+
+        auto payloadStart = data.size();
+        write(static_cast<uint8_t>(op), data);
+        write(static_cast<uint8_t>(shutdownType), data);
+        write(static_cast<uint8_t>(alarmType), data);
+        write(timestamp, data);
+        data.insert(data.end(), sensorPath.begin(), sensorPath.end());
+
+        write(fnv1a(data.data() + payloadStart, size), data);
+    }
+
+    /**
+     * @brief Applies a record's payload to the timestamps map.
+     */
+    static void apply(const uint8_t* payload, size_t size,
+                      std::map<AlarmKey, uint64_t>& timestamps)
+    {
+        auto op = static_cast<Op>(payload[0]);
+        AlarmKey key{std::string{reinterpret_cast<const char*>(payload) +
+                                     fixedPayloadSize,
+                                 size - fixedPayloadSize},
+                     static_cast<ShutdownType>(payload[1]),
+                     static_cast<AlarmType>(payload[2])};
+
+        if (op == Op::add)
+        {
+            uint64_t timestamp;
+            std::memcpy(&timestamp, payload + 3, sizeof(timestamp));
+            timestamps[key] = timestamp;
+        }
+        else if (op == Op::erase)
+        {
+            timestamps.erase(key);
+        }
+    }
+
+    /**
+     * @brief Writes all of data to fd.
+     */
+    static bool writeAll(int fd, const std::vector<uint8_t>& data)
+    {
+        size_t written = 0;
+        while (written < data.size())
+        {
+            auto rc = ::write(fd, data.data() + written, data.size() - written);
+            if (rc < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                return false;
+            }
+            written += rc;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Creates the journal's directory if necessary.
+     */
+    void createParentDir() const
+    {
+        std::error_code ec;
+        std::filesystem::create_directories(_path.parent_path(), ec);
+    }
+
+    /**
+     * @brief Appends one record, starting a new journal if necessary.
+     */
+    void append(Op op, const AlarmKey& key, uint64_t timestamp)
+    {
+        createParentDir();
+
+        int fd = open(_path.c_str(), O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC,
+                      0644);
+        if (fd < 0)
+        {
+            lg2::error("Could not open {PATH}: {ERRNO}", "PATH", _path,
+                       "ERRNO", errno);
+            return;
+        }
+
+        std::vector<uint8_t> data;
+        if (lseek(fd, 0, SEEK_END) == 0)
+        {
+            data.assign(magic.begin(), magic.end());
+        }
+        encode(op, key, timestamp, data);
+
+        if (!writeAll(fd, data) || (fdatasync(fd) != 0))
+        {
+            lg2::error("Could not append to {PATH}: {ERRNO}", "PATH", _path,
+                       "ERRNO", errno);
+        }
+        close(fd);
+
+        _appended++;
+    }
+
+    /**
+     * @brief The journal file path
+     */
+    const std::filesystem::path _path;
+
+    /**
+     * @brief How many appends trigger a compaction
+     */
+    const size_t _compactAfter;
+
+    /**
+     * @brief The records appended since the last compaction
+     */
+    size_t _appended = 0;
+};
+
+} // namespace sensor::monitor
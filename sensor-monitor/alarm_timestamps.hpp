@@ -16,6 +16,7 @@
 #pragma once
 #include "config.h"
 
+#include "alarm_journal.hpp"
 #include "types.hpp"
 
 #include <cereal/archives/json.hpp>
@@ -56,8 +57,13 @@ class AlarmTimestamps
      * @brief Constructor
      *
      * Loads any saved timestamps
+     *
+     * @param[in] persistDir - The directory to persist the
+     *                         timestamps in
      */
-    AlarmTimestamps()
+    explicit AlarmTimestamps(const std::filesystem::path& persistDir =
+                                 SENSOR_MONITOR_PERSIST_ROOT_PATH) :
+        dir(persistDir), journal(persistDir / journalFilename)
     {
         load();
     }
@@ -76,7 +82,8 @@ class AlarmTimestamps
         auto result = timestamps.emplace(key, timestamp);
         if (result.second)
         {
-            save();
+            journal.add(key, timestamp);
+            compactIfNeeded();
         }
     }
 
@@ -90,7 +97,8 @@ class AlarmTimestamps
         size_t removed = timestamps.erase(key);
         if (removed)
         {
-            save();
+            journal.erase(key);
+            compactIfNeeded();
         }
     }
 
@@ -99,8 +107,10 @@ class AlarmTimestamps
      */
     void erase(std::map<AlarmKey, uint64_t>::const_iterator& entry)
     {
+        auto key = entry->first;
         timestamps.erase(entry);
-        save();
+        journal.erase(key);
+        compactIfNeeded();
     }
 
     /**
@@ -170,60 +180,71 @@ class AlarmTimestamps
     }
 
     /**
-     * @brief Saves the timestamps map in the filesystem using cereal.
-     *
-     * Since cereal doesn't understand the AlarmType or ShutdownType
-     * enums, they are converted to ints before being written.
+     * @brief Saves the timestamps map in the filesystem by compacting
+     *        the journal down to the current entries.
      */
     void save()
     {
-        std::filesystem::path path =
-            std::filesystem::path{SENSOR_MONITOR_PERSIST_ROOT_PATH} /
-            timestampsFilename;
-
-        if (!std::filesystem::exists(path.parent_path()))
-        {
-            std::filesystem::create_directories(path.parent_path());
-        }
+        journal.compact(timestamps);
+    }
 
-        std::vector<std::tuple<std::string, int, int, uint64_t>> times;
+  private:
+    static constexpr auto timestampsFilename = "shutdownAlarmStartTimes";
+    static constexpr auto journalFilename = "shutdownAlarmStartTimes.journal";
 
-        for (const auto& [key, time] : timestamps)
+    /**
+     * @brief Compacts the journal if enough records were
+     *        appended since the last time.
+     */
+    void compactIfNeeded()
+    {
+        if (journal.needsCompaction())
         {
-            times.emplace_back(std::get<std::string>(key),
-                               static_cast<int>(std::get<ShutdownType>(key)),
-                               static_cast<int>(std::get<AlarmType>(key)),
-                               time);
+            save();
         }
-
-        std::ofstream stream{path.c_str()};
-        cereal::JSONOutputArchive oarchive{stream};
-
-        oarchive(times);
     }
 
-  private:
-    static constexpr auto timestampsFilename = "shutdownAlarmStartTimes";
-
     /**
-     * @brief Loads the saved timestamps from the filesystem.
+     * @brief Loads the saved timestamps by replaying the journal.
      *
-     * As with save(), cereal doesn't understand the ShutdownType or AlarmType
-     * enums so they have to have been saved as ints and converted.
+     * If there is no journal yet but there is a timestamps file from
+     * before the journal was used, that is loaded instead and converted.
      */
     void load()
     {
-        std::vector<std::tuple<std::string, int, int, uint64_t>> times;
+        if (std::filesystem::exists(journal.path()))
+        {
+            timestamps = journal.replay();
+            return;
+        }
 
-        std::filesystem::path path =
-            std::filesystem::path{SENSOR_MONITOR_PERSIST_ROOT_PATH} /
-            timestampsFilename;
+        auto path = dir / timestampsFilename;
 
         if (!std::filesystem::exists(path))
         {
             return;
         }
 
+        loadLegacy(path);
+        save();
+
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+    }
+
+    /**
+     * @brief Loads the timestamps from the cereal JSON file that
+     *        was used before the journal.
+     *
+     * Cereal doesn't understand the ShutdownType or AlarmType
+     * enums so they have to have been saved as ints and converted.
+     *
+     * @param[in] path - The file path
+     */
+    void loadLegacy(const std::filesystem::path& path)
+    {
+        std::vector<std::tuple<std::string, int, int, uint64_t>> times;
+
         try
         {
             std::ifstream stream{path.c_str()};
@@ -240,14 +261,21 @@ class AlarmTimestamps
         }
         catch (const std::exception& e)
         {
-            // Include possible exception when removing file, otherwise ec = 0
-            std::error_code ec;
-            std::filesystem::remove(path, ec);
-            lg2::error("Unable to restore persisted times ({ERROR}, ec: {EC})",
-                       "ERROR", e, "EC", ec.value());
+            lg2::error("Unable to restore persisted times ({ERROR})", "ERROR",
+                       e);
         }
     }
 
+    /**
+     * @brief The directory the timestamps are persisted in
+     */
+    const std::filesystem::path dir;
+
+    /**
+     * @brief The journal the timestamps are persisted in
+     */
+    AlarmJournal journal;
+
     /**
      * @brief The map of AlarmKeys and time start times.
      */
@@ -0,0 +1,231 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#include "event_log_queue.hpp"
+
+#include "sdbusplus.hpp"
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <algorithm>
+
+namespace sensor::monitor
+{
+
+using namespace phosphor::fan::util;
+
+constexpr auto loggingService = "xyz.openbmc_project.Logging";
+constexpr auto loggingPath = "/xyz/openbmc_project/logging";
+constexpr auto loggingCreateIface = "xyz.openbmc_project.Logging.Create";
+
+EventLogQueue::EventLogQueue(sdbusplus::bus_t& bus, sdeventplus::Event& event,
+                             std::chrono::milliseconds debounce,
+                             size_t maxPerSecond, size_t maxBacklog) :
+    _bus(bus), _debounce(debounce),
+    _maxBacklog(std::max<size_t>(maxBacklog, 1)),
+    _timer(event, std::bind(&EventLogQueue::timerExpired, this)),
+    _interval(std::max<std::chrono::milliseconds::rep>(
+        1000 / std::max<size_t>(maxPerSecond, 1), 1))
+{}
+
+void EventLogQueue::add(const std::string& key, bool asserted,
+                        const std::string& errorName,
+                        const std::string& severity, AdditionalData&& ad)
+{
+    _queued++;
+
+    auto held = std::find_if(
+        _queue.begin(), _queue.end(),
+        [&key](const auto& entry) { return entry.key == key; });
+
+    if (held != _queue.end())
+    {
+        if (held->asserted != asserted)
+        {
+            // A set and clear (or clear and set) inside the debounce
+            // window cancel each other out.
+            lg2::info("Not creating {ERROR_NAME} or {NEW_ERROR_NAME} "
+                      "because the alarm changed back within {TIME}ms",
+                      "ERROR_NAME", held->errorName, "NEW_ERROR_NAME",
+                      errorName, "TIME", _debounce.count());
+            _queue.erase(held);
+            _coalesced += 2;
+            return;
+        }
+
+        // Same direction as what's held, which can happen when alarms
+        // are rechecked at power on, so just keep the newer data.
+        held->errorName = errorName;
+        held->severity = severity;
+        held->ad = std::move(ad);
+        _coalesced++;
+        return;
+    }
+
+    if (!asserted && _droppedSets.erase(key))
+    {
+        // The set was dropped, so don't log only its clear
+        lg2::error("Dropping {ERROR_NAME} for {KEY} since the event log "
+                   "for the alarm being set was dropped",
+                   "ERROR_NAME", errorName, "KEY", key);
+        _dropped++;
+        return;
+    }
+
+    if (_queue.size() >= _maxBacklog)
+    {
+        // Make room by dropping the oldest set, whose clear will then
+        // be dropped too.  A held clear is never dropped, because the
+        // log for its set was already created.
+        auto set = std::find_if(_queue.begin(), _queue.end(),
+                                [](const auto& entry) {
+                                    return entry.asserted;
+                                });
+
+        if (set != _queue.end())
+        {
+            lg2::error(
+                "Event log backlog full, dropping {ERROR_NAME} for {KEY}",
+                "ERROR_NAME", set->errorName, "KEY", set->key);
+            _droppedSets.insert(set->key);
+            _queue.erase(set);
+            _dropped++;
+        }
+        else if (asserted)
+        {
+            // Only clears are held, so drop this set instead
+            lg2::error(
+                "Event log backlog full, dropping {ERROR_NAME} for {KEY}",
+                "ERROR_NAME", errorName, "KEY", key);
+            _droppedSets.insert(key);
+            _dropped++;
+            return;
+        }
+    }
+
+    if (asserted)
+    {
+        // In case a set was dropped before and rechecked at power on
+        _droppedSets.erase(key);
+    }
+
+    _queue.emplace_back(key, asserted, errorName, severity, std::move(ad),
+                        Clock::now() + _debounce);
+
+    if (!_timer.isEnabled())
+    {
+        schedule();
+    }
+}
+
+void EventLogQueue::create(const std::string& errorName,
+                           const std::string& severity,
+                           const AdditionalData& ad)
+{
+    _sent++;
+
+    try
+    {
+        SDBusPlus::callMethod(loggingService, loggingPath, loggingCreateIface,
+                              "Create", errorName, severity, ad);
+    }
+    catch (const DBusError& e)
+    {
+        _failed++;
+        throw;
+    }
+}
+
+void EventLogQueue::timerExpired()
+{
+    // Every entry has the same debounce, so they become
+    // ready in the order they were added.
+    if (!_queue.empty() && (_queue.front().sendTime <= Clock::now()))
+    {
+        send(_queue.front());
+        _queue.pop_front();
+    }
+
+    schedule();
+}
+
+void EventLogQueue::schedule()
+{
+    if (_queue.empty())
+    {
+        _timer.setEnabled(false);
+        return;
+    }
+
+    // The oldest log is always the next one ready, but it can't be
+    // sent any sooner than the rate limit allows.
+    auto when = std::max(_queue.front().sendTime, _lastSend + _interval);
+    auto delay = std::max(when - Clock::now(), Clock::duration::zero());
+
+    _timer.restartOnce(
+        std::chrono::duration_cast<std::chrono::microseconds>(delay));
+}
+
+void EventLogQueue::send(const Entry& entry)
+{
+    _sent++;
+    _lastSend = Clock::now();
+
+    try
+    {
+        auto msg = _bus.new_method_call(loggingService, loggingPath,
+                                        loggingCreateIface, "Create");
+        msg.append(entry.errorName, entry.severity, entry.ad);
+
+        // A null slot makes it a floating call, which sd-bus cleans
+        // up by itself after the reply arrives.
+        auto rc = sd_bus_call_async(_bus.get(), nullptr, msg.get(),
+                                    &EventLogQueue::created, this, 0);
+        if (rc < 0)
+        {
+            lg2::error("Failed calling Create for {ERROR_NAME}: {RC}",
+                       "ERROR_NAME", entry.errorName, "RC", rc);
+            _failed++;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        lg2::error("Failed calling Create for {ERROR_NAME}: {ERROR}",
+                   "ERROR_NAME", entry.errorName, "ERROR", e);
+        _failed++;
+    }
+}
+
+int EventLogQueue::created(sd_bus_message* reply, void* userData,
+                           sd_bus_error* /*error*/)
+{
+    auto* queue = static_cast<EventLogQueue*>(userData);
+
+    if (sd_bus_message_is_method_error(reply, nullptr))
+    {
+        const auto* error = sd_bus_message_get_error(reply);
+        lg2::error("Event log Create call failed: {ERROR}", "ERROR",
+                   (error && error->message) ? error->message : "unknown");
+        queue->_failed++;
+    }
+
+    return 0;
+}
+
+nlohmann::json EventLogQueue::getStats() const
+{
+    auto backlog = nlohmann::json::array();
+    for (const auto& entry : _queue)
+    {
+        backlog.push_back(entry.errorName + " " + entry.key);
+    }
+
+    return nlohmann::json{{"queued", _queued},
+                          {"coalesced", _coalesced},
+                          {"dropped", _dropped},
+                          {"sent", _sent},
+                          {"failed", _failed},
+                          {"backlog", std::move(backlog)}};
+}
+
+} // namespace sensor::monitor
@@ -0,0 +1,206 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include <systemd/sd-bus.h>
+
+#include <nlohmann/json.hpp>
+#include <sdbusplus/bus.hpp>
+#include <sdeventplus/clock.hpp>
+#include <sdeventplus/event.hpp>
+#include <sdeventplus/utility/timer.hpp>
+
+#include <chrono>
+#include <deque>
+#include <map>
+#include <set>
+#include <string>
+
+namespace sensor::monitor
+{
+
+/**
+ * @class EventLogQueue
+ *
+ * Creates the sensor alarm event logs asynchronously, so that a burst
+ * of alarms doesn't block the processing of other sensors on
+ * synchronous Logging.Create calls.
+ *
+ * Each log is held for a debounce window before being created.  If the
+ * opposite transition of the same sensor alarm arrives within that
+ * window, such as a clear right after a set from a sensor flapping
+ * around its threshold, both are dropped and counted as coalesced.
+ *
+ * Held logs are sent in order at no more than a fixed rate, without
+ * waiting for the replies.  The backlog is bounded; when it is full
+ * the oldest held set is dropped to make room, along with the clear
+ * for it when that comes, so only whole set/clear pairs are lost.
+ * Held clears are never dropped.
+ */
+class EventLogQueue
+{
+  public:
+    using AdditionalData = std::map<std::string, std::string>;
+
+    EventLogQueue() = delete;
+    ~EventLogQueue() = default;
+    EventLogQueue(const EventLogQueue&) = delete;
+    EventLogQueue& operator=(const EventLogQueue&) = delete;
+    EventLogQueue(EventLogQueue&&) = delete;
+    EventLogQueue& operator=(EventLogQueue&&) = delete;
+
+    /**
+     * @brief Constructor
+     *
+     * @param[in] bus - The sdbusplus bus object
+     * @param[in] event - The sdeventplus event object
+     * @param[in] debounce - How long to hold each log
+     * @param[in] maxPerSecond - The maximum logs to create per second
+     * @param[in] maxBacklog - The maximum logs to hold
+     */
+    EventLogQueue(sdbusplus::bus_t& bus, sdeventplus::Event& event,
+                  std::chrono::milliseconds debounce, size_t maxPerSecond,
+                  size_t maxBacklog);
+
+    /**
+     * @brief Queues an event log for an alarm set or clear.
+     *
+     * @param[in] key - Identifies the sensor alarm, used to pair up
+     *                  sets and clears
+     * @param[in] asserted - If the alarm was set or cleared
+     * @param[in] errorName - The event log error name
+     * @param[in] severity - The event log severity
+     * @param[in] ad - The event log additional data
+     */
+    void add(const std::string& key, bool asserted,
+             const std::string& errorName, const std::string& severity,
+             AdditionalData&& ad);
+
+    /**
+     * @brief Creates an event log right away with a synchronous call,
+     *        for when the caller can't wait, such as before a
+     *        power off.
+     *
+     * @param[in] errorName - The event log error name
+     * @param[in] severity - The event log severity
+     * @param[in] ad - The event log additional data
+     */
+    void create(const std::string& errorName, const std::string& severity,
+                const AdditionalData& ad);
+
+    /**
+     * @brief Returns the counters and the current backlog for a dump.
+     */
+    nlohmann::json getStats() const;
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief A held event log
+     */
+    struct Entry
+    {
+        std::string key;
+        bool asserted;
+        std::string errorName;
+        std::string severity;
+        AdditionalData ad;
+        Clock::time_point sendTime;
+    };
+
+    /**
+     * @brief The timer callback that sends the oldest log once its
+     *        debounce window is over.
+     */
+    void timerExpired();
+
+    /**
+     * @brief Arms the timer for when the oldest log can be sent, or
+     *        disables it when nothing is held.
+     */
+    void schedule();
+
+    /**
+     * @brief Makes an asynchronous Logging.Create call.
+     *
+     * @param[in] entry - The log to create
+     */
+    void send(const Entry& entry);
+
+    /**
+     * @brief The sd-bus reply handler for the Create calls.
+     */
+    static int created(sd_bus_message* reply, void* userData,
+                       sd_bus_error* error);
+
+    /**
+     * @brief The sdbusplus bus object
+     */
+    sdbusplus::bus_t& _bus;
+
+    /**
+     * @brief How long each log is held
+     */
+    const std::chrono::milliseconds _debounce;
+
+    /**
+     * @brief The maximum number of held logs
+     */
+    const size_t _maxBacklog;
+
+    /**
+     * @brief The held logs, oldest first
+     */
+    std::deque<Entry> _queue;
+
+    /**
+     * @brief The sensor alarms whose set was dropped, so that
+     *        their clear is dropped too
+     */
+    std::set<std::string> _droppedSets;
+
+    /**
+     * @brief Fires once when the oldest held log can be sent
+     */
+    sdeventplus::utility::Timer<sdeventplus::ClockId::Monotonic> _timer;
+
+    /**
+     * @brief The minimum time between Create calls
+     */
+    const std::chrono::milliseconds _interval;
+
+    /**
+     * @brief When the last Create call was made
+     */
+    Clock::time_point _lastSend{};
+
+    /**
+     * @brief Number of logs added to the queue
+     */
+    size_t _queued = 0;
+
+    /**
+     * @brief Number of logs that were dropped because the other
+     *        half of their set/clear pair arrived in time
+     */
+    size_t _coalesced = 0;
+
+    /**
+     * @brief Number of logs dropped because the backlog was full
+     */
+    size_t _dropped = 0;
+
+    /**
+     * @brief Number of Create calls made
+     */
+    size_t _sent = 0;
+
+    /**
+     * @brief Number of Create calls that failed
+     */
+    size_t _failed = 0;
+};
+
+} // namespace sensor::monitor
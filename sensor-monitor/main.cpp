@@ -13,15 +13,29 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include "config.h"
+
+#include "event_log_queue.hpp"
 #include "power_state.hpp"
+#include "service_tracker.hpp"
 #include "shutdown_alarm_monitor.hpp"
+#include "signal_dispatcher.hpp"
 #include "threshold_alarm_logger.hpp"
+#include "trend_alarm_monitor.hpp"
 
+#include <phosphor-logging/lg2.hpp>
 #include <sdbusplus/bus.hpp>
 #include <sdeventplus/event.hpp>
+#include <sdeventplus/source/signal.hpp>
+#include <stdplus/signal.hpp>
+
+#include <fstream>
+#include <iomanip>
 
 using namespace sensor::monitor;
 
+constexpr auto dumpFile = "/tmp/sensor_monitor_dump.json";
+
 int main(int, char*[])
 {
     auto event = sdeventplus::Event::get_default();
@@ -36,9 +50,42 @@ int main(int, char*[])
         std::make_shared<phosphor::fan::PGoodState>();
 #endif
 
-    ShutdownAlarmMonitor shutdownMonitor{bus, event, powerState};
+    SignalDispatcher dispatcher{bus};
+
+    auto services = std::make_shared<ServiceTracker>(bus, dispatcher);
+
+    auto eventLogs = std::make_shared<EventLogQueue>(
+        bus, event, std::chrono::milliseconds{EVENT_LOG_DEBOUNCE_MS},
+        EVENT_LOG_MAX_PER_SECOND, EVENT_LOG_MAX_BACKLOG);
+
+    ShutdownAlarmMonitor shutdownMonitor{bus,      event,     powerState,
+                                         services, eventLogs, dispatcher};
+
+    ThresholdAlarmLogger logger{bus, powerState, services, eventLogs,
+                                dispatcher};
+
+    TrendAlarmMonitor trendMonitor{powerState, eventLogs, dispatcher};
+
+    // Enable SIGUSR1 handling to dump debug data
+    stdplus::signal::block(SIGUSR1);
+    sdeventplus::source::Signal sigUsr1(
+        event, SIGUSR1,
+        [&eventLogs, &trendMonitor](sdeventplus::source::Signal&,
+                                    const struct signalfd_siginfo*) {
+            nlohmann::json output;
+            output["event_logs"] = eventLogs->getStats();
+            output["trends"] = trendMonitor.getStats();
 
-    ThresholdAlarmLogger logger{bus, powerState};
+            std::ofstream file{dumpFile};
+            if (!file)
+            {
+                lg2::error("Could not open file for sensor monitor dump");
+            }
+            else
+            {
+                file << std::setw(4) << output;
+            }
+        });
 
     return event.loop();
 }
@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#include "service_tracker.hpp"
+
+#include "sdbusplus.hpp"
+
+#include <phosphor-logging/lg2.hpp>
+
+namespace sensor::monitor
+{
+
+using namespace phosphor::fan::util;
+namespace rules = sdbusplus::bus::match::rules;
+
+ServiceTracker::ServiceTracker(sdbusplus::bus_t& bus,
+                               SignalDispatcher& dispatcher) :
+    _bus(bus), _dispatcher(dispatcher),
+    _nameOwnerChangedMatch(bus, rules::nameOwnerChanged(),
+                           std::bind(&ServiceTracker::nameOwnerChanged, this,
+                                     std::placeholders::_1))
+{
+    _dispatcher.addInterfacesAddedHandler(
+        std::bind(&ServiceTracker::interfacesAdded, this, std::placeholders::_1,
+                  std::placeholders::_2, std::placeholders::_3));
+
+    _dispatcher.addInterfacesRemovedHandler(
+        std::bind(&ServiceTracker::interfacesRemoved, this,
+                  std::placeholders::_1, std::placeholders::_2));
+}
+
+void ServiceTracker::track(const std::vector<std::string>& interfaces)
+{
+    for (const auto& interface : interfaces)
+    {
+        if (_interfaces.insert(interface).second)
+        {
+            // Whoever sends a signal for a sensor is hosting it.
+            _dispatcher.addPropertiesHandler(
+                interface,
+                [this](const std::string& path, const std::string& intf,
+                       const PropertyMap&, const std::string& sender) {
+                    add(path, intf, sender);
+                });
+        }
+    }
+
+    try
+    {
+        auto subtree = SDBusPlus::getSubTreeRaw(_bus, "/", interfaces, 0);
+
+        for (const auto& [path, services] : subtree)
+        {
+            for (const auto& [service, intfs] : services)
+            {
+                for (const auto& intf : intfs)
+                {
+                    add(path, intf, service);
+                }
+            }
+        }
+    }
+    catch (const DBusError& e)
+    {
+        lg2::error("Could not find the sensors to track: {ERROR}", "ERROR",
+                   e);
+    }
+}
+
+void ServiceTracker::add(const std::string& path, const std::string& interface,
+                         const std::string& service)
+{
+    if (_interfaces.contains(interface))
+    {
+        _objects[InterfaceKey{path, interface}] = service;
+    }
+}
+
+void ServiceTracker::nameOwnerChanged(sdbusplus::message_t& msg)
+{
+    std::string name;
+    std::string oldOwner;
+    std::string newOwner;
+
+    msg.read(name, oldOwner, newOwner);
+
+    // Entries may be stored under either the well known name (from the
+    // mapper) or the unique name (from a signal's sender).
+    if (!oldOwner.empty())
+    {
+        removeService(oldOwner);
+    }
+
+    if (newOwner.empty())
+    {
+        removeService(name);
+    }
+}
+
+void ServiceTracker::interfacesAdded(const std::string& path,
+                                     const InterfaceMap& interfaces,
+                                     const std::string& sender)
+{
+    for (const auto& [interface, properties] : interfaces)
+    {
+        add(path, interface, sender);
+    }
+}
+
+void ServiceTracker::interfacesRemoved(
+    const std::string& path, const std::vector<std::string>& interfaces)
+{
+    for (const auto& interface : interfaces)
+    {
+        _objects.erase(InterfaceKey{path, interface});
+    }
+}
+
+void ServiceTracker::removeService(const std::string& service)
+{
+    std::erase_if(_objects, [&service](const auto& object) {
+        return object.second == service;
+    });
+}
+
+} // namespace sensor::monitor
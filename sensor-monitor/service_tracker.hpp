@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include "signal_dispatcher.hpp"
+#include "types.hpp"
+
+#include <sdbusplus/bus.hpp>
+#include <sdbusplus/bus/match.hpp>
+
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace sensor::monitor
+{
+
+/**
+ * @class ServiceTracker
+ *
+ * Keeps track of which D-Bus service hosts each sensor object path and
+ * interface of interest, so the alarm code can tell if a sensor is still
+ * on D-Bus without asking the mapper.
+ *
+ * Entries are added by an initial mapper GetSubTree call for the tracked
+ * interfaces, and then by InterfacesAdded signals and the sender of any
+ * PropertiesChanged signal on them.  They are removed when an
+ * InterfacesRemoved signal says the interface is gone or when a
+ * NameOwnerChanged signal says the hosting service has exited.
+ */
+class ServiceTracker
+{
+  public:
+    ServiceTracker() = delete;
+    ~ServiceTracker() = default;
+    ServiceTracker(const ServiceTracker&) = delete;
+    ServiceTracker& operator=(const ServiceTracker&) = delete;
+    ServiceTracker(ServiceTracker&&) = delete;
+    ServiceTracker& operator=(ServiceTracker&&) = delete;
+
+    /**
+     * @brief Constructor
+     *
+     * @param[in] bus - The sdbusplus bus object
+     * @param[in] dispatcher - The SignalDispatcher object
+     */
+    ServiceTracker(sdbusplus::bus_t& bus, SignalDispatcher& dispatcher);
+
+    /**
+     * @brief Starts tracking the interfaces passed in, and finds
+     *        all current instances of them with one mapper call.
+     *
+     * @param[in] interfaces - The interfaces to track
+     */
+    void track(const std::vector<std::string>& interfaces);
+
+    /**
+     * @brief Records that a service hosts an interface on a path.
+     *
+     * Does nothing if the interface isn't tracked.
+     *
+     * @param[in] path - The object path
+     * @param[in] interface - The interface
+     * @param[in] service - The service name, well known or unique
+     */
+    void add(const std::string& path, const std::string& interface,
+             const std::string& service);
+
+    /**
+     * @brief Says if the interface on the path is still hosted
+     *        by a running service.
+     *
+     * @param[in] path - The object path
+     * @param[in] interface - The interface
+     *
+     * @return bool - If it is still on D-Bus
+     */
+    bool hosted(const std::string& path, const std::string& interface) const
+    {
+        return _objects.contains(InterfaceKey{path, interface});
+    }
+
+    /**
+     * @brief Returns the service that hosts the interface on the
+     *        path, if there is one.
+     *
+     * @param[in] path - The object path
+     * @param[in] interface - The interface
+     *
+     * @return std::optional<std::string> - The service name
+     */
+    std::optional<std::string> getService(const std::string& path,
+                                          const std::string& interface) const
+    {
+        auto it = _objects.find(InterfaceKey{path, interface});
+        if (it == _objects.end())
+        {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    /**
+     * @brief Returns all of the hosted paths and interfaces along
+     *        with their services.
+     */
+    const std::map<InterfaceKey, std::string>& objects() const
+    {
+        return _objects;
+    }
+
+  private:
+    /**
+     * @brief The NameOwnerChanged handler.
+     *
+     * Removes everything hosted by a service that lost its owner.
+     *
+     * @param[in] msg - The signal message payload.
+     */
+    void nameOwnerChanged(sdbusplus::message_t& msg);
+
+    /**
+     * @brief The InterfacesAdded handler.
+     *
+     * @param[in] path - The object path
+     * @param[in] interfaces - The interfaces added
+     * @param[in] sender - The service that sent the signal
+     */
+    void interfacesAdded(const std::string& path,
+                         const InterfaceMap& interfaces,
+                         const std::string& sender);
+
+    /**
+     * @brief The InterfacesRemoved handler.
+     *
+     * @param[in] path - The object path
+     * @param[in] interfaces - The interfaces removed
+     */
+    void interfacesRemoved(const std::string& path,
+                           const std::vector<std::string>& interfaces);
+
+    /**
+     * @brief Removes every entry hosted by the service.
+     *
+     * @param[in] service - The service name
+     */
+    void removeService(const std::string& service);
+
+    /**
+     * @brief The sdbusplus bus object
+     */
+    sdbusplus::bus_t& _bus;
+
+    /**
+     * @brief The SignalDispatcher object
+     */
+    SignalDispatcher& _dispatcher;
+
+    /**
+     * @brief The tracked interfaces
+     */
+    std::set<std::string> _interfaces;
+
+    /**
+     * @brief The service hosting each tracked path and interface
+     */
+    std::map<InterfaceKey, std::string> _objects;
+
+    /**
+     * @brief The NameOwnerChanged match object
+     */
+    sdbusplus::match _nameOwnerChangedMatch;
+};
+
+} // namespace sensor::monitor
@@ -76,34 +76,28 @@ constexpr auto systemdPath = "/org/freedesktop/systemd1";
 constexpr auto systemdMgrIface = "org.freedesktop.systemd1.Manager";
 constexpr auto valueInterface = "xyz.openbmc_project.Sensor.Value";
 constexpr auto valueProperty = "Value";
-const auto loggingService = "xyz.openbmc_project.Logging";
-const auto loggingPath = "/xyz/openbmc_project/logging";
-const auto loggingCreateIface = "xyz.openbmc_project.Logging.Create";
-
-using namespace sdbusplus::bus::match;
+constexpr auto objectManagerIface = "org.freedesktop.DBus.ObjectManager";
 
 ShutdownAlarmMonitor::ShutdownAlarmMonitor(
     sdbusplus::bus_t& bus, sdeventplus::Event& event,
-    std::shared_ptr<PowerState> powerState) :
+    std::shared_ptr<PowerState> powerState,
+    std::shared_ptr<ServiceTracker> services,
+    std::shared_ptr<EventLogQueue> eventLogs, SignalDispatcher& dispatcher) :
     bus(bus), event(event), _powerState(std::move(powerState)),
-    hardShutdownMatch(bus,
-                      "type='signal',member='PropertiesChanged',"
-                      "path_namespace='/xyz/openbmc_project/sensors',"
-                      "arg0='" +
-                          shutdownInterfaces.at(ShutdownType::hard) + "'",
-                      std::bind(&ShutdownAlarmMonitor::propertiesChanged, this,
-                                std::placeholders::_1)),
-    softShutdownMatch(bus,
-                      "type='signal',member='PropertiesChanged',"
-                      "path_namespace='/xyz/openbmc_project/sensors',"
-                      "arg0='" +
-                          shutdownInterfaces.at(ShutdownType::soft) + "'",
-                      std::bind(&ShutdownAlarmMonitor::propertiesChanged, this,
-                                std::placeholders::_1))
+    _services(std::move(services)), _eventLogs(std::move(eventLogs))
 {
     _powerState->addCallback("shutdownMon",
                              std::bind(&ShutdownAlarmMonitor::powerStateChanged,
                                        this, std::placeholders::_1));
+
+    for (const auto& [shutdownType, interface] : shutdownInterfaces)
+    {
+        dispatcher.addPropertiesHandler(
+            interface, std::bind(&ShutdownAlarmMonitor::propertiesChanged,
+                                 this, std::placeholders::_1,
+                                 std::placeholders::_2, std::placeholders::_3));
+    }
+
     findAlarms();
 
     if (_powerState->isPowerOn())
@@ -122,39 +116,54 @@ ShutdownAlarmMonitor::ShutdownAlarmMonitor(
 
 void ShutdownAlarmMonitor::findAlarms()
 {
-    // Find all shutdown threshold ifaces currently on D-Bus.
+    std::vector<std::string> interfaces;
     for (const auto& [shutdownType, interface] : shutdownInterfaces)
     {
-        auto paths = SDBusPlus::getSubTreePathsRaw(bus, "/", interface, 0);
+        interfaces.push_back(interface);
+    }
 
-        auto shutdownType2 = shutdownType;
+    // Find all shutdown threshold ifaces currently on D-Bus.
+    _services->track(interfaces);
 
-        std::for_each(
-            paths.begin(), paths.end(),
-            [this, shutdownType2](const auto& path) {
-                alarms.emplace(AlarmKey{path, shutdownType2, AlarmType::high},
-                               nullptr);
-                alarms.emplace(AlarmKey{path, shutdownType2, AlarmType::low},
-                               nullptr);
-            });
+    for (const auto& [interfaceKey, service] : _services->objects())
+    {
+        const auto& [path, interface] = interfaceKey;
+        auto shutdownType = getShutdownType(interface);
+        if (shutdownType)
+        {
+            alarms.emplace(AlarmKey{path, *shutdownType, AlarmType::high},
+                           nullptr);
+            alarms.emplace(AlarmKey{path, *shutdownType, AlarmType::low},
+                           nullptr);
+        }
     }
 }
 
 void ShutdownAlarmMonitor::checkAlarms()
 {
+    auto start = std::chrono::steady_clock::now();
+    std::map<AlarmKey, bool> values;
+    size_t serviceCount = 0;
+    bool bulkRead = true;
+
+    try
+    {
+        values = getAlarmValues(serviceCount);
+    }
+    catch (const DBusError& e)
+    {
+        lg2::error("Could not read the shutdown alarms in bulk: {ERROR}",
+                   "ERROR", e);
+        bulkRead = false;
+    }
+
     for (auto& [alarmKey, timer] : alarms)
     {
         const auto& [sensorPath, shutdownType, alarmType] = alarmKey;
         const auto& interface = shutdownInterfaces.at(shutdownType);
-        auto propertyName = alarmProperties.at(shutdownType).at(alarmType);
         bool value;
 
-        try
-        {
-            value = SDBusPlus::getProperty<bool>(bus, sensorPath, interface,
-                                                 propertyName);
-        }
-        catch (const DBusServiceError& e)
+        if (!_services->hosted(sensorPath, interface))
         {
             // The sensor isn't on D-Bus anymore
             lg2::info("No {INTERFACE} interface on {SENSOR_PATH} anymore.",
@@ -162,30 +171,191 @@ void ShutdownAlarmMonitor::checkAlarms()
             continue;
         }
 
+        if (bulkRead)
+        {
+            auto it = values.find(alarmKey);
+            if (it == values.end())
+            {
+                // The sensor isn't on D-Bus anymore
+                lg2::info("No {INTERFACE} interface on {SENSOR_PATH} anymore.",
+                          "INTERFACE", interface, "SENSOR_PATH", sensorPath);
+                continue;
+            }
+            value = it->second;
+        }
+        else
+        {
+            auto propertyName = alarmProperties.at(shutdownType).at(alarmType);
+
+            try
+            {
+                value = SDBusPlus::getProperty<bool>(bus, sensorPath, interface,
+                                                     propertyName);
+            }
+            catch (const DBusServiceError& e)
+            {
+                // The sensor isn't on D-Bus anymore
+                lg2::info("No {INTERFACE} interface on {SENSOR_PATH} anymore.",
+                          "INTERFACE", interface, "SENSOR_PATH", sensorPath);
+                continue;
+            }
+        }
+
         checkAlarm(value, alarmKey);
     }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+
+    lg2::info("Checked {COUNT} shutdown alarms from {SERVICES} services "
+              "in {TIME}ms",
+              "COUNT", alarms.size(), "SERVICES", serviceCount, "TIME",
+              elapsed.count());
+}
+
+std::map<AlarmKey, bool> ShutdownAlarmMonitor::getAlarmValues(
+    size_t& serviceCount)
+{
+    std::map<AlarmKey, bool> values;
+    std::vector<std::string> interfaces{objectManagerIface};
+    for (const auto& [shutdownType, interface] : shutdownInterfaces)
+    {
+        interfaces.push_back(interface);
+    }
+
+    // One mapper call finds both the sensors with shutdown
+    // interfaces and where their services' object managers are.
+    auto subtree = SDBusPlus::getSubTreeRaw(bus, "/", interfaces, 0);
+
+    std::map<std::string, std::vector<std::string>> objMgrPaths;
+    std::map<std::string, std::vector<std::pair<std::string, ShutdownType>>>
+        sensorPaths;
+
+    for (const auto& [path, services] : subtree)
+    {
+        for (const auto& [service, intfs] : services)
+        {
+            for (const auto& intf : intfs)
+            {
+                if (intf == objectManagerIface)
+                {
+                    objMgrPaths[service].push_back(path);
+                }
+                else if (auto type = getShutdownType(intf); type)
+                {
+                    sensorPaths[service].emplace_back(path, *type);
+                }
+            }
+        }
+    }
+
+    serviceCount = sensorPaths.size();
+
+    for (const auto& [service, paths] : sensorPaths)
+    {
+        if (auto mgrs = objMgrPaths.find(service); mgrs != objMgrPaths.end())
+        {
+            for (const auto& objMgrPath : mgrs->second)
+            {
+                try
+                {
+                    auto objects =
+                        SDBusPlus::getManagedObjects<std::variant<bool>>(
+                            bus, service, objMgrPath);
+
+                    for (const auto& [path, intfs] : objects)
+                    {
+                        addAlarmValues(path.str, intfs, values);
+                    }
+                }
+                catch (const DBusError& e)
+                {
+                    lg2::error("GetManagedObjects failed on {SERVICE} "
+                               "{PATH}: {ERROR}",
+                               "SERVICE", service, "PATH", objMgrPath,
+                               "ERROR", e);
+                }
+            }
+        }
+
+        // Read the properties the object managers didn't cover, if
+        // any, directly.  The service is already known so there's no
+        // mapper call needed.
+        for (const auto& [path, shutdownType] : paths)
+        {
+            const auto& interface = shutdownInterfaces.at(shutdownType);
+            for (const auto& [alarmType, propertyName] :
+                 alarmProperties.at(shutdownType))
+            {
+                AlarmKey key{path, shutdownType, alarmType};
+                if (values.contains(key))
+                {
+                    continue;
+                }
+
+                try
+                {
+                    values[key] = SDBusPlus::getProperty<bool>(
+                        bus, service, path, interface, propertyName);
+                }
+                catch (const DBusError& e)
+                {
+                    // Leave it out, as if it wasn't on D-Bus
+                }
+            }
+        }
+    }
+
+    return values;
 }
 
-void ShutdownAlarmMonitor::propertiesChanged(sdbusplus::message_t& message)
+void ShutdownAlarmMonitor::addAlarmValues(
+    const std::string& path,
+    const std::map<std::string, std::map<std::string, std::variant<bool>>>&
+        interfaces,
+    std::map<AlarmKey, bool>& values) const
 {
-    std::map<std::string, std::variant<bool>> properties;
-    std::string interface;
+    for (const auto& [interface, properties] : interfaces)
+    {
+        auto shutdownType = getShutdownType(interface);
+        if (!shutdownType)
+        {
+            continue;
+        }
+
+        for (const auto& [alarmType, propertyName] :
+             alarmProperties.at(*shutdownType))
+        {
+            auto property = properties.find(propertyName);
+            if (property == properties.end())
+            {
+                continue;
+            }
+
+            if (const auto* value = std::get_if<bool>(&property->second);
+                value)
+            {
+                values[AlarmKey{path, *shutdownType, alarmType}] = *value;
+            }
+        }
+    }
+}
 
+void ShutdownAlarmMonitor::propertiesChanged(const std::string& sensorPath,
+                                             const std::string& interface,
+                                             const PropertyMap& properties)
+{
     if (!_powerState->isPowerOn())
     {
         return;
     }
 
-    message.read(interface, properties);
-
     auto type = getShutdownType(interface);
     if (!type)
     {
         return;
     }
 
-    std::string sensorPath = message.get_path();
-
     const auto& lowAlarmName = alarmProperties.at(*type).at(AlarmType::low);
     if (properties.count(lowAlarmName) > 0)
     {
@@ -452,8 +622,18 @@ void ShutdownAlarmMonitor::createEventLog(
         ad.emplace("SEVERITY_DETAIL", "SYSTEM_TERM");
     }
 
-    SDBusPlus::callMethod(loggingService, loggingPath, loggingCreateIface,
-                          "Create", errorName, convertForMessage(severity), ad);
+    // A power off is about to happen, so don't hold that one.
+    if (isPowerOffError)
+    {
+        _eventLogs->create(errorName, convertForMessage(severity), ad);
+    }
+    else
+    {
+        const auto& propertyName =
+            alarmProperties.at(shutdownType).at(alarmType);
+        _eventLogs->add(sensorPath + " " + propertyName, alarmValue, errorName,
+                        convertForMessage(severity), std::move(ad));
+    }
 }
 
 std::optional<ShutdownType> ShutdownAlarmMonitor::getShutdownType(
@@ -15,17 +15,21 @@
  */
 #pragma once
 #include "alarm_timestamps.hpp"
+#include "event_log_queue.hpp"
 #include "power_state.hpp"
+#include "service_tracker.hpp"
+#include "signal_dispatcher.hpp"
 #include "types.hpp"
 
 #include <sdbusplus/bus.hpp>
-#include <sdbusplus/bus/match.hpp>
 #include <sdeventplus/clock.hpp>
 #include <sdeventplus/event.hpp>
 #include <sdeventplus/utility/timer.hpp>
 
 #include <chrono>
+#include <map>
 #include <optional>
+#include <variant>
 
 namespace sensor::monitor
 {
@@ -69,9 +73,15 @@ class ShutdownAlarmMonitor
      * @param[in] bus - The sdbusplus bus object
      * @param[in] event - The sdeventplus event object
      * @param[in] powerState - The PowerState object
+     * @param[in] services - The ServiceTracker object
+     * @param[in] eventLogs - The EventLogQueue object
+     * @param[in] dispatcher - The SignalDispatcher to get signals from
      */
     ShutdownAlarmMonitor(sdbusplus::bus_t& bus, sdeventplus::Event& event,
-                         std::shared_ptr<phosphor::fan::PowerState> powerState);
+                         std::shared_ptr<phosphor::fan::PowerState> powerState,
+                         std::shared_ptr<ServiceTracker> services,
+                         std::shared_ptr<EventLogQueue> eventLogs,
+                         SignalDispatcher& dispatcher);
 
   private:
     /**
@@ -79,8 +89,14 @@ class ShutdownAlarmMonitor
      *
      * If the power is on, the new alarm values will be checked to see
      * if the shutdown timer needs to be started or stopped.
+     *
+     * @param[in] sensorPath - The sensor object path
+     * @param[in] interface - The shutdown interface
+     * @param[in] properties - The changed properties
      */
-    void propertiesChanged(sdbusplus::message_t& message);
+    void propertiesChanged(const std::string& sensorPath,
+                           const std::string& interface,
+                           const PropertyMap& properties);
 
     /**
      * @brief Checks an alarm value to see if a shutdown timer needs
@@ -97,10 +113,41 @@ class ShutdownAlarmMonitor
     /**
      * @brief Checks all currently known alarm properties on D-Bus.
      *
+     * Alarms on sensors that are no longer hosted are skipped.
      * May result in starting or stopping shutdown timers.
      */
     void checkAlarms();
 
+    /**
+     * @brief Reads the values of all shutdown alarm properties on D-Bus.
+     *
+     * Uses a single mapper GetSubTree call to group the sensors by
+     * service, and then one GetManagedObjects call per object manager
+     * of those services.  Any properties the object managers didn't
+     * return, like when a service doesn't have one, are read
+     * individually.
+     *
+     * @param[out] serviceCount - The number of services that host
+     *                            shutdown alarm interfaces
+     *
+     * @return std::map<AlarmKey, bool> - The alarm property values
+     */
+    std::map<AlarmKey, bool> getAlarmValues(size_t& serviceCount);
+
+    /**
+     * @brief Adds the shutdown alarm property values found in
+     *        an object's interfaces to the values map.
+     *
+     * @param[in] path - The object path
+     * @param[in] interfaces - The object's interfaces and properties
+     * @param[in,out] values - The alarm property values
+     */
+    void addAlarmValues(
+        const std::string& path,
+        const std::map<std::string,
+                       std::map<std::string, std::variant<bool>>>& interfaces,
+        std::map<AlarmKey, bool>& values) const;
+
     /**
      * @brief Finds all shutdown alarm interfaces currently on
      *        D-Bus and adds them to the alarms map.
@@ -151,6 +198,9 @@ class ShutdownAlarmMonitor
     /**
      * @brief Creates a phosphor-logging event log
      *
+     * Power off logs are created right away, others go through
+     * the EventLogQueue.
+     *
      * @param[in] alarmKey - The alarm key
      * @param[in] alarmValue - The alarm property value
      * @param[in] sensorValue - The sensor value behind the alarm.
@@ -182,16 +232,15 @@ class ShutdownAlarmMonitor
     std::shared_ptr<phosphor::fan::PowerState> _powerState;
 
     /**
-     * @brief The match for properties changing on the HardShutdown
-     *        interface.
+     * @brief The ServiceTracker object to know if sensors are
+     *        still on D-Bus.
      */
-    sdbusplus::match hardShutdownMatch;
+    std::shared_ptr<ServiceTracker> _services;
 
     /**
-     * @brief The match for properties changing on the SoftShutdown
-     *        interface.
+     * @brief The EventLogQueue object that creates the event logs
      */
-    sdbusplus::match softShutdownMatch;
+    std::shared_ptr<EventLogQueue> _eventLogs;
 
     /**
      * @brief The map of alarms.
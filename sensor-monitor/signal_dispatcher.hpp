@@ -0,0 +1,259 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include <sdbusplus/bus.hpp>
+#include <sdbusplus/bus/match.hpp>
+#include <sdbusplus/message.hpp>
+
+#include <functional>
+#include <map>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace sensor::monitor
+{
+
+/**
+ * @brief The property types the sensor monitors care about.  Others
+ *        are skipped when the message is read.
+ */
+using PropertyValue = std::variant<bool, double>;
+using PropertyMap = std::map<std::string, PropertyValue>;
+using InterfaceMap = std::map<std::string, PropertyMap>;
+
+/**
+ * @brief Called with the path, interface, changed properties, and
+ *        sender of a PropertiesChanged signal.
+ */
+using PropertiesHandler =
+    std::function<void(const std::string&, const std::string&,
+                       const PropertyMap&, const std::string&)>;
+
+/**
+ * @brief Called with the path, interfaces, and sender of an
+ *        InterfacesAdded signal.
+ */
+using InterfacesAddedHandler = std::function<void(
+    const std::string&, const InterfaceMap&, const std::string&)>;
+
+/**
+ * @brief Called with the path and interfaces of an InterfacesRemoved
+ *        signal.
+ */
+using InterfacesRemovedHandler = std::function<void(
+    const std::string&, const std::vector<std::string>&)>;
+
+/**
+ * @class SignalDispatcher
+ *
+ * Subscribes once to the signals under the sensors namespace on behalf
+ * of all of the sensor monitors, decodes each message once, and hands
+ * the result to the handlers registered for it.
+ *
+ * The PropertiesChanged match covers all of the
+ * xyz.openbmc_project.Sensor.Threshold.* interfaces, so the frequent
+ * sensor value updates still don't wake the process up.  Handlers are
+ * registered per interface, and the properties of a signal are only
+ * decoded if some handler wants that interface.
+ */
+class SignalDispatcher
+{
+  public:
+    SignalDispatcher() = delete;
+    ~SignalDispatcher() = default;
+    SignalDispatcher(const SignalDispatcher&) = delete;
+    SignalDispatcher& operator=(const SignalDispatcher&) = delete;
+    SignalDispatcher(SignalDispatcher&&) = delete;
+    SignalDispatcher& operator=(SignalDispatcher&&) = delete;
+
+    /**
+     * @brief Constructor
+     *
+     * @param[in] bus - The sdbusplus bus object
+     */
+    explicit SignalDispatcher(sdbusplus::bus_t& bus) :
+        _bus(bus),
+        _propertiesMatch(
+            bus,
+            "type='signal',interface='org.freedesktop.DBus.Properties',"
+            "member='PropertiesChanged',"
+            "path_namespace='/xyz/openbmc_project/sensors',"
+            "arg0namespace='xyz.openbmc_project.Sensor.Threshold'",
+            [this](sdbusplus::message_t& msg) { propertiesChanged(msg); }),
+        _objectManagerMatch(
+            bus,
+            "type='signal',interface='org.freedesktop.DBus.ObjectManager',"
+            "arg0path='/xyz/openbmc_project/sensors/'",
+            [this](sdbusplus::message_t& msg) { objectManagerSignal(msg); })
+    {}
+
+    /**
+     * @brief Registers a PropertiesChanged handler for an interface.
+     *
+     * @param[in] interface - The interface
+     * @param[in] handler - The handler
+     */
+    void addPropertiesHandler(const std::string& interface,
+                              PropertiesHandler&& handler)
+    {
+        _propertiesHandlers[interface].push_back(std::move(handler));
+    }
+
+    /**
+     * @brief Subscribes to PropertiesChanged signals for an interface
+     *        outside of the threshold interfaces, such as the sensor
+     *        Value interface, under a path namespace.
+     *
+     * The signals go to the handlers registered for the interface.
+     * Keep the namespace narrow for frequently changing interfaces.
+     *
+     * @param[in] interface - The interface
+     * @param[in] pathNamespace - The path namespace
+     */
+    void subscribe(const std::string& interface,
+                   const std::string& pathNamespace)
+    {
+        _extraMatches.emplace_back(
+            _bus,
+            "type='signal',interface='org.freedesktop.DBus.Properties',"
+            "member='PropertiesChanged',path_namespace='" +
+                pathNamespace + "',arg0='" + interface + "'",
+            [this](sdbusplus::message_t& msg) { propertiesChanged(msg); });
+    }
+
+    /**
+     * @brief Registers an InterfacesAdded handler.
+     *
+     * @param[in] handler - The handler
+     */
+    void addInterfacesAddedHandler(InterfacesAddedHandler&& handler)
+    {
+        _addedHandlers.push_back(std::move(handler));
+    }
+
+    /**
+     * @brief Registers an InterfacesRemoved handler.
+     *
+     * @param[in] handler - The handler
+     */
+    void addInterfacesRemovedHandler(InterfacesRemovedHandler&& handler)
+    {
+        _removedHandlers.push_back(std::move(handler));
+    }
+
+    /**
+     * @brief Decodes a PropertiesChanged signal and passes it to the
+     *        handlers for its interface.
+     *
+     * @param[in] msg - The signal message
+     */
+    void propertiesChanged(sdbusplus::message_t& msg)
+    {
+        std::string interface;
+        msg.read(interface);
+
+        auto handlers = _propertiesHandlers.find(interface);
+        if (handlers == _propertiesHandlers.end())
+        {
+            return;
+        }
+
+        PropertyMap properties;
+        msg.read(properties);
+
+        std::string path = msg.get_path();
+        std::string sender = msg.get_sender();
+
+        for (const auto& handler : handlers->second)
+        {
+            handler(path, interface, properties, sender);
+        }
+    }
+
+    /**
+     * @brief Decodes an InterfacesAdded or InterfacesRemoved signal and
+     *        passes it to the handlers for it.
+     *
+     * @param[in] msg - The signal message
+     */
+    void objectManagerSignal(sdbusplus::message_t& msg)
+    {
+        std::string member = msg.get_member();
+
+        if (member == "InterfacesAdded")
+        {
+            if (_addedHandlers.empty())
+            {
+                return;
+            }
+
+            sdbusplus::message::object_path path;
+            InterfaceMap interfaces;
+            msg.read(path, interfaces);
+
+            std::string sender = msg.get_sender();
+
+            for (const auto& handler : _addedHandlers)
+            {
+                handler(path.str, interfaces, sender);
+            }
+        }
+        else if (member == "InterfacesRemoved")
+        {
+            if (_removedHandlers.empty())
+            {
+                return;
+            }
+
+            sdbusplus::message::object_path path;
+            std::vector<std::string> interfaces;
+            msg.read(path, interfaces);
+
+            for (const auto& handler : _removedHandlers)
+            {
+                handler(path.str, interfaces);
+            }
+        }
+    }
+
+  private:
+    /**
+     * @brief The sdbusplus bus object
+     */
+    sdbusplus::bus_t& _bus;
+
+    /**
+     * @brief The PropertiesChanged handlers by interface
+     */
+    std::map<std::string, std::vector<PropertiesHandler>> _propertiesHandlers;
+
+    /**
+     * @brief The InterfacesAdded handlers
+     */
+    std::vector<InterfacesAddedHandler> _addedHandlers;
+
+    /**
+     * @brief The InterfacesRemoved handlers
+     */
+    std::vector<InterfacesRemovedHandler> _removedHandlers;
+
+    /**
+     * @brief The PropertiesChanged match object
+     */
+    sdbusplus::match _propertiesMatch;
+
+    /**
+     * @brief The InterfacesAdded/Removed match object
+     */
+    sdbusplus::match _objectManagerMatch;
+
+    /**
+     * @brief The match objects from subscribe()
+     */
+    std::vector<sdbusplus::match> _extraMatches;
+};
+
+} // namespace sensor::monitor
@@ -0,0 +1,237 @@
+#include "../alarm_journal.hpp"
+#include "../alarm_timestamps.hpp"
+
+#include <cereal/archives/json.hpp>
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace sensor::monitor;
+namespace fs = std::filesystem;
+
+class AlarmJournalTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        char dirName[] = "/tmp/alarmjournalXXXXXX";
+        ASSERT_NE(mkdtemp(dirName), nullptr);
+        dir = dirName;
+        path = dir / "journal";
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(dir);
+    }
+
+    /**
+     * @brief Chops bytes off the end of the journal file
+     */
+    void truncate(size_t bytes)
+    {
+        fs::resize_file(path, fs::file_size(path) - bytes);
+    }
+
+    /**
+     * @brief Flips the bits of the journal byte at offset
+     */
+    void corrupt(size_t offset)
+    {
+        std::fstream file{path, std::ios::binary | std::ios::in |
+                                    std::ios::out};
+        file.seekg(offset);
+        auto c = static_cast<char>(file.get());
+        file.seekp(offset);
+        file.put(static_cast<char>(~c));
+    }
+
+    fs::path dir;
+    fs::path path;
+
+    const AlarmKey key1{"/xyz/openbmc_project/sensors/temperature/t1",
+                        ShutdownType::hard, AlarmType::high};
+    const AlarmKey key2{"/xyz/openbmc_project/sensors/temperature/t2",
+                        ShutdownType::soft, AlarmType::low};
+    const AlarmKey key3{"/xyz/openbmc_project/sensors/voltage/v1",
+                        ShutdownType::hard, AlarmType::low};
+
+    // magic + size + op/types/timestamp + hash
+    static constexpr size_t headerSize = 8;
+    static constexpr size_t recordOverhead = 4 + 3 + 8 + 4;
+
+    size_t recordSize(const AlarmKey& key) const
+    {
+        return recordOverhead + std::get<std::string>(key).size();
+    }
+};
+
+TEST_F(AlarmJournalTest, RoundTrip)
+{
+    {
+        AlarmJournal journal{path};
+        EXPECT_TRUE(journal.replay().empty());
+
+        journal.add(key1, 1000);
+        journal.add(key2, 2000);
+        journal.add(key3, 3000);
+        journal.erase(key2);
+
+        // A set after a clear
+        journal.add(key2, 4000);
+        journal.erase(key3);
+    }
+
+    AlarmJournal journal{path};
+    auto timestamps = journal.replay();
+
+    std::map<AlarmKey, uint64_t> expected{{key1, 1000}, {key2, 4000}};
+    EXPECT_EQ(timestamps, expected);
+
+    // Nothing was bad, so it wasn't compacted
+    EXPECT_EQ(fs::file_size(path),
+              headerSize + recordSize(key1) * 1 + recordSize(key2) * 3 +
+                  recordSize(key3) * 2);
+
+    // Replaying again gives the same thing
+    EXPECT_EQ(journal.replay(), expected);
+}
+
+TEST_F(AlarmJournalTest, TruncatedRecord)
+{
+    {
+        AlarmJournal journal{path};
+        journal.add(key1, 1000);
+        journal.add(key2, 2000);
+    }
+
+    // Like a power loss in the middle of the last write
+    truncate(5);
+
+    AlarmJournal journal{path};
+    std::map<AlarmKey, uint64_t> expected{{key1, 1000}};
+    EXPECT_EQ(journal.replay(), expected);
+
+    // It was compacted, so new records go after a good one
+    EXPECT_EQ(fs::file_size(path), headerSize + recordSize(key1));
+
+    journal.add(key3, 3000);
+    expected.emplace(key3, 3000);
+    EXPECT_EQ(journal.replay(), expected);
+}
+
+TEST_F(AlarmJournalTest, BadHash)
+{
+    {
+        AlarmJournal journal{path};
+        journal.add(key1, 1000);
+        journal.add(key2, 2000);
+        journal.add(key3, 3000);
+    }
+
+    // A byte of the second record's sensor path
+    corrupt(headerSize + recordSize(key1) + recordSize(key2) - 5);
+
+    AlarmJournal journal{path};
+    std::map<AlarmKey, uint64_t> expected{{key1, 1000}};
+    EXPECT_EQ(journal.replay(), expected);
+
+    // The bad record and everything after it is gone
+    EXPECT_EQ(fs::file_size(path), headerSize + recordSize(key1));
+    EXPECT_EQ(journal.replay(), expected);
+}
+
+TEST_F(AlarmJournalTest, BadMagic)
+{
+    {
+        AlarmJournal journal{path};
+        journal.add(key1, 1000);
+    }
+
+    corrupt(0);
+
+    AlarmJournal journal{path};
+    EXPECT_TRUE(journal.replay().empty());
+    EXPECT_EQ(fs::file_size(path), headerSize);
+}
+
+TEST_F(AlarmJournalTest, Compaction)
+{
+    AlarmJournal journal{path, 4};
+    std::map<AlarmKey, uint64_t> timestamps;
+
+    for (uint64_t i = 0; i < 3; i++)
+    {
+        journal.add(key1, i);
+        timestamps[key1] = i;
+        EXPECT_FALSE(journal.needsCompaction());
+    }
+
+    journal.add(key2, 2000);
+    timestamps[key2] = 2000;
+    EXPECT_TRUE(journal.needsCompaction());
+
+    journal.compact(timestamps);
+    EXPECT_FALSE(journal.needsCompaction());
+    EXPECT_EQ(fs::file_size(path),
+              headerSize + recordSize(key1) + recordSize(key2));
+    EXPECT_FALSE(fs::exists(path.string() + ".tmp"));
+
+    EXPECT_EQ(journal.replay(), timestamps);
+
+    // Replayed records count toward the next compaction
+    EXPECT_FALSE(journal.needsCompaction());
+    journal.erase(key1);
+    journal.erase(key2);
+    EXPECT_TRUE(journal.needsCompaction());
+}
+
+TEST_F(AlarmJournalTest, TimestampsPersist)
+{
+    {
+        AlarmTimestamps timestamps{dir};
+        timestamps.add(key1, 1000);
+        timestamps.add(key2, 2000);
+        timestamps.erase(key1);
+    }
+
+    AlarmTimestamps timestamps{dir};
+    std::map<AlarmKey, uint64_t> expected{{key2, 2000}};
+    EXPECT_EQ(timestamps.get(), expected);
+}
+
+TEST_F(AlarmJournalTest, LegacyMigration)
+{
+    // The cereal file from before the journal
+    const auto legacyPath = dir / "shutdownAlarmStartTimes";
+    {
+        std::vector<std::tuple<std::string, int, int, uint64_t>> times{
+            {std::get<std::string>(key1), 0, 1, 1000},
+            {std::get<std::string>(key2), 1, 0, 2000}};
+
+        std::ofstream stream{legacyPath};
+        cereal::JSONOutputArchive oarchive{stream};
+        oarchive(times);
+    }
+
+    std::map<AlarmKey, uint64_t> expected{{key1, 1000}, {key2, 2000}};
+
+    {
+        AlarmTimestamps timestamps{dir};
+        EXPECT_EQ(timestamps.get(), expected);
+    }
+
+    // It was converted to the journal and the old file removed
+    EXPECT_FALSE(fs::exists(legacyPath));
+    EXPECT_TRUE(fs::exists(dir / "shutdownAlarmStartTimes.journal"));
+
+    AlarmTimestamps timestamps{dir};
+    EXPECT_EQ(timestamps.get(), expected);
+}
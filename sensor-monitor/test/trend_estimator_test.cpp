@@ -0,0 +1,79 @@
+#include "../trend_estimator.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace sensor::monitor;
+using namespace std::chrono_literals;
+
+TEST(TrendEstimatorTest, NotEnoughSamplesTest)
+{
+    TrendEstimator estimator{60s, 5};
+    auto start = TrendEstimator::Clock::now();
+
+    // Too few samples
+    for (int i = 0; i < 4; i++)
+    {
+        estimator.add(start + i * 10s, 20.0 + i);
+    }
+    EXPECT_FALSE(estimator.rate());
+
+    // Enough samples, but not covering half the window
+    estimator.clear();
+    for (int i = 0; i < 10; i++)
+    {
+        estimator.add(start + i * 1s, 20.0 + i);
+    }
+    EXPECT_FALSE(estimator.rate());
+
+    estimator.add(start + 30s, 50.0);
+    EXPECT_TRUE(estimator.rate());
+}
+
+TEST(TrendEstimatorTest, RateTest)
+{
+    TrendEstimator estimator{60s, 5};
+    auto start = TrendEstimator::Clock::now();
+
+    // Rising 2 degrees a minute, with a little noise
+    for (int i = 0; i <= 60; i++)
+    {
+        double noise = (i % 2) ? 0.05 : -0.05;
+        estimator.add(start + i * 1s, 25.0 + i / 30.0 + noise);
+    }
+    ASSERT_TRUE(estimator.rate());
+    EXPECT_NEAR(*estimator.rate(), 2.0, 0.01);
+
+    // Then flat, which takes over once the window slides past the rise
+    for (int i = 61; i <= 180; i++)
+    {
+        estimator.add(start + i * 1s, 27.0);
+    }
+    EXPECT_EQ(estimator.size(), 61u);
+    ASSERT_TRUE(estimator.rate());
+    EXPECT_NEAR(*estimator.rate(), 0.0, 1e-6);
+
+    // Then falling 6 a minute
+    for (int i = 181; i <= 300; i++)
+    {
+        estimator.add(start + i * 1s, 27.0 - (i - 180) / 10.0);
+    }
+    ASSERT_TRUE(estimator.rate());
+    EXPECT_NEAR(*estimator.rate(), -6.0, 1e-6);
+}
+
+TEST(TrendEstimatorTest, LongRunTest)
+{
+    TrendEstimator estimator{60s, 5};
+    auto start = TrendEstimator::Clock::now();
+
+    // Days of samples, to check the sums stay accurate
+    // as the origin moves along.
+    for (int i = 0; i < 3 * 24 * 3600; i++)
+    {
+        estimator.add(start + i * 1s, 5000.0 + (i % 600));
+    }
+
+    // The last 60 samples rise 1 per second.
+    ASSERT_TRUE(estimator.rate());
+    EXPECT_NEAR(*estimator.rate(), 60.0, 1e-3);
+}
@@ -37,9 +37,6 @@ const std::string criticalInterface =
     "xyz.openbmc_project.Sensor.Threshold.Critical";
 const std::string perfLossInterface =
     "xyz.openbmc_project.Sensor.Threshold.PerformanceLoss";
-constexpr auto loggingService = "xyz.openbmc_project.Logging";
-constexpr auto loggingPath = "/xyz/openbmc_project/logging";
-constexpr auto loggingCreateIface = "xyz.openbmc_project.Logging.Create";
 constexpr auto errorNameBase = "xyz.openbmc_project.Sensor.Threshold.Error.";
 constexpr auto valueInterface = "xyz.openbmc_project.Sensor.Value";
 constexpr auto assocInterface = "xyz.openbmc_project.Association";
@@ -86,79 +83,49 @@ const std::map<InterfaceName, std::map<PropertyName, std::map<bool, ErrorData>>>
                               Entry::Level::Informational}}}}}}};
 
 ThresholdAlarmLogger::ThresholdAlarmLogger(
-    sdbusplus::bus_t& bus, std::shared_ptr<PowerState> powerState) :
+    sdbusplus::bus_t& bus, std::shared_ptr<PowerState> powerState,
+    std::shared_ptr<ServiceTracker> services,
+    std::shared_ptr<EventLogQueue> eventLogs, SignalDispatcher& dispatcher) :
     bus(bus), _powerState(std::move(powerState)),
-    warningMatch(bus,
-                 "type='signal',member='PropertiesChanged',"
-                 "path_namespace='/xyz/openbmc_project/sensors',"
-                 "arg0='" +
-                     warningInterface + "'",
-                 std::bind(&ThresholdAlarmLogger::propertiesChanged, this,
-                           std::placeholders::_1)),
-    criticalMatch(bus,
-                  "type='signal',member='PropertiesChanged',"
-                  "path_namespace='/xyz/openbmc_project/sensors',"
-                  "arg0='" +
-                      criticalInterface + "'",
-                  std::bind(&ThresholdAlarmLogger::propertiesChanged, this,
-                            std::placeholders::_1)),
-    perfLossMatch(bus,
-                  "type='signal',member='PropertiesChanged',"
-                  "path_namespace='/xyz/openbmc_project/sensors',"
-                  "arg0='" +
-                      perfLossInterface + "'",
-                  std::bind(&ThresholdAlarmLogger::propertiesChanged, this,
-                            std::placeholders::_1)),
-    ifacesRemovedMatch(bus,
-                       "type='signal',member='InterfacesRemoved',arg0path="
-                       "'/xyz/openbmc_project/sensors/'",
-                       std::bind(&ThresholdAlarmLogger::interfacesRemoved, this,
-                                 std::placeholders::_1)),
-    ifacesAddedMatch(bus,
-                     "type='signal',member='InterfacesAdded',arg0path="
-                     "'/xyz/openbmc_project/sensors/'",
-                     std::bind(&ThresholdAlarmLogger::interfacesAdded, this,
-                               std::placeholders::_1))
+    _services(std::move(services)), _eventLogs(std::move(eventLogs))
 {
     _powerState->addCallback("thresholdMon",
                              std::bind(&ThresholdAlarmLogger::powerStateChanged,
                                        this, std::placeholders::_1));
 
-    // check for any currently asserted threshold alarms
-    std::for_each(
-        thresholdData.begin(), thresholdData.end(),
-        [this](const auto& thresholdInterface) {
-            const auto& interface = thresholdInterface.first;
-            auto objects =
-                SDBusPlus::getSubTreeRaw(this->bus, "/", interface, 0);
-            std::for_each(objects.begin(), objects.end(),
-                          [interface, this](const auto& object) {
-                              const auto& path = object.first;
-                              const auto& service =
-                                  object.second.begin()->first;
-                              this->checkThresholds(interface, path, service);
-                          });
-        });
-}
+    for (const auto& interface : thresholdIfaceNames)
+    {
+        dispatcher.addPropertiesHandler(
+            interface,
+            std::bind(&ThresholdAlarmLogger::checkProperties, this,
+                      std::placeholders::_1, std::placeholders::_2,
+                      std::placeholders::_3));
+    }
 
-void ThresholdAlarmLogger::propertiesChanged(sdbusplus::message_t& msg)
-{
-    std::map<std::string, std::variant<bool>> properties;
-    std::string sensorPath = msg.get_path();
-    std::string interface;
+    dispatcher.addInterfacesAddedHandler(
+        std::bind(&ThresholdAlarmLogger::interfacesAdded, this,
+                  std::placeholders::_1, std::placeholders::_2));
+
+    dispatcher.addInterfacesRemovedHandler(
+        std::bind(&ThresholdAlarmLogger::interfacesRemoved, this,
+                  std::placeholders::_1, std::placeholders::_2));
 
-    msg.read(interface, properties);
+    _services->track(thresholdIfaceNames);
 
-    checkProperties(sensorPath, interface, properties);
+    // check for any currently asserted threshold alarms
+    for (const auto& [interfaceKey, service] : _services->objects())
+    {
+        const auto& [path, interface] = interfaceKey;
+        if (thresholdData.contains(interface))
+        {
+            checkThresholds(interface, path, service);
+        }
+    }
 }
 
-void ThresholdAlarmLogger::interfacesRemoved(sdbusplus::message_t& msg)
+void ThresholdAlarmLogger::interfacesRemoved(
+    const std::string& path, const std::vector<std::string>& interfaces)
 {
-    sdbusplus::object_path path;
-    std::vector<std::string> interfaces;
-
-    msg.read(path, interfaces);
-
     for (const auto& interface : interfaces)
     {
         if (std::find(thresholdIfaceNames.begin(), thresholdIfaceNames.end(),
@@ -169,13 +136,9 @@ void ThresholdAlarmLogger::interfacesRemoved(sdbusplus::message_t& msg)
     }
 }
 
-void ThresholdAlarmLogger::interfacesAdded(sdbusplus::message_t& msg)
+void ThresholdAlarmLogger::interfacesAdded(const std::string& path,
+                                           const InterfaceMap& interfaces)
 {
-    sdbusplus::object_path path;
-    std::map<std::string, std::map<std::string, std::variant<bool>>> interfaces;
-
-    msg.read(path, interfaces);
-
     for (const auto& [interface, properties] : interfaces)
     {
         if (std::find(thresholdIfaceNames.begin(), thresholdIfaceNames.end(),
@@ -186,9 +149,9 @@ void ThresholdAlarmLogger::interfacesAdded(sdbusplus::message_t& msg)
     }
 }
 
-void ThresholdAlarmLogger::checkProperties(
-    const std::string& sensorPath, const std::string& interface,
-    const std::map<std::string, std::variant<bool>>& properties)
+void ThresholdAlarmLogger::checkProperties(const std::string& sensorPath,
+                                           const std::string& interface,
+                                           const PropertyMap& properties)
 {
     auto alarmProperties = thresholdData.find(interface);
     if (alarmProperties == thresholdData.end())
@@ -360,8 +323,8 @@ void ThresholdAlarmLogger::createEventLog(
         errorName += " on sensor " + getSensorName(sensorPath);
     }
 
-    SDBusPlus::callMethod(loggingService, loggingPath, loggingCreateIface,
-                          "Create", errorName, convertForMessage(severity), ad);
+    _eventLogs->add(sensorPath + " " + alarmProperty, alarmValue, errorName,
+                    convertForMessage(severity), std::move(ad));
 }
 
 std::string ThresholdAlarmLogger::getSensorName(const std::string& sensorPath)
@@ -451,28 +414,19 @@ void ThresholdAlarmLogger::checkThresholds()
             {
                 const auto& sensorPath = std::get<0>(interfaceKey);
                 const auto& interface = std::get<1>(interfaceKey);
-                std::string service;
 
-                try
+                // If the service that provided the alarm died while the
+                // alarm was active there would be no other indication of it.
+                if (_services->hosted(sensorPath, interface))
                 {
-                    // Check that the service that provides the alarm is still
-                    // running, because if it died when the alarm was active
-                    // there would be no indication of it unless we listened
-                    // for NameOwnerChanged and tracked services, and this is
-                    // easier.
-                    service = SDBusPlus::getService(bus, sensorPath, interface);
+                    createEventLog(sensorPath, interface, propertyName,
+                                   alarmValue);
                 }
-                catch (const DBusServiceError& e)
+                else
                 {
                     // No longer on D-Bus delete the alarm entry
                     toErase.emplace_back(sensorPath, interface);
                 }
-
-                if (!service.empty())
-                {
-                    createEventLog(sensorPath, interface, propertyName,
-                                   alarmValue);
-                }
             }
         }
     }
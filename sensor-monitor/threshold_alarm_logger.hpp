@@ -15,21 +15,21 @@
  */
 #pragma once
 
+#include "event_log_queue.hpp"
 #include "power_state.hpp"
+#include "service_tracker.hpp"
+#include "signal_dispatcher.hpp"
+#include "types.hpp"
 
 #include <sdbusplus/bus.hpp>
-#include <sdbusplus/bus/match.hpp>
 #include <sdeventplus/event.hpp>
 
 namespace sensor::monitor
 {
 
-using InterfaceName = std::string;
 using PropertyName = std::string;
 using ErrorName = std::string;
 using ErrorStatus = std::string;
-using ObjectPath = std::string;
-using InterfaceKey = std::tuple<ObjectPath, InterfaceName>;
 
 /**
  * @class ThresholdAlarmLogger
@@ -65,30 +65,28 @@ class ThresholdAlarmLogger
      *
      * @param[in] bus - The sdbusplus bus object
      * @param[in] powerState - The PowerState object
+     * @param[in] services - The ServiceTracker object
+     * @param[in] eventLogs - The EventLogQueue object
+     * @param[in] dispatcher - The SignalDispatcher to get signals from
      */
     ThresholdAlarmLogger(sdbusplus::bus_t& bus,
-                         std::shared_ptr<phosphor::fan::PowerState> powerState);
+                         std::shared_ptr<phosphor::fan::PowerState> powerState,
+                         std::shared_ptr<ServiceTracker> services,
+                         std::shared_ptr<EventLogQueue> eventLogs,
+                         SignalDispatcher& dispatcher);
 
   private:
-    /**
-     * @brief The propertiesChanged handler for all of the thresholds
-     *        interfaces.
-     *
-     * Creates event logs for high/low alarm sets and clears.
-     *
-     * @param[in] msg - The signal message payload.
-     */
-    void propertiesChanged(sdbusplus::message_t& msg);
-
     /**
      * @brief The interfacesRemoved removed handler for the threshold
      *        interfaces.
      *
      * Removes that threshold from the alarms map
      *
-     * @param[in] msg - The signal message payload.
+     * @param[in] path - The object path
+     * @param[in] interfaces - The interfaces removed
      */
-    void interfacesRemoved(sdbusplus::message_t& msg);
+    void interfacesRemoved(const std::string& path,
+                           const std::vector<std::string>& interfaces);
 
     /**
      * @brief The interfacesAdded handler for the threshold
@@ -96,21 +94,26 @@ class ThresholdAlarmLogger
      *
      * Checks the alarm when it shows up on D-Bus.
      *
-     * @param[in] msg - The signal message payload.
+     * @param[in] path - The object path
+     * @param[in] interfaces - The interfaces added
      */
-    void interfacesAdded(sdbusplus::message_t& msg);
+    void interfacesAdded(const std::string& path,
+                         const InterfaceMap& interfaces);
 
     /**
      * @brief Checks for alarms in the D-Bus data passed in,
      *        and creates an event log if necessary.
      *
+     * This is also the PropertiesChanged handler for all of the
+     * threshold interfaces.
+     *
      * @param[in] sensorPath - D-Bus path of the sensor
      * @param[in] interface - The threshold interface name
      * @param[in] properties - The map of property values on the interface
      */
-    void checkProperties(
-        const std::string& sensorPath, const std::string& interface,
-        const std::map<std::string, std::variant<bool>>& properties);
+    void checkProperties(const std::string& sensorPath,
+                         const std::string& interface,
+                         const PropertyMap& properties);
 
     /**
      * @brief Checks for active alarms on the path and threshold interface
@@ -128,11 +131,13 @@ class ThresholdAlarmLogger
      * @brief Checks for all active alarms on all existing
      *        threshold interfaces and creates event logs
      *        if necessary.
+     *
+     * Alarms on sensors that are no longer hosted are removed.
      */
     void checkThresholds();
 
     /**
-     * @brief Creates an event log for the alarm set/clear
+     * @brief Queues an event log for the alarm set/clear
      *
      * @param[in] sensorPath - The sensor object path
      * @param[in] interface - The threshold interface
@@ -210,29 +215,15 @@ class ThresholdAlarmLogger
     std::shared_ptr<phosphor::fan::PowerState> _powerState;
 
     /**
-     * @brief The Warning interface match object
-     */
-    sdbusplus::match warningMatch;
-
-    /**
-     * @brief The Critical interface match object
-     */
-    sdbusplus::match criticalMatch;
-
-    /**
-     * @brief The PerformanceLoss interface match object
-     */
-    sdbusplus::match perfLossMatch;
-
-    /**
-     * @brief The InterfacesRemoved match object
+     * @brief The ServiceTracker object to know if sensors are
+     *        still on D-Bus.
      */
-    sdbusplus::match ifacesRemovedMatch;
+    std::shared_ptr<ServiceTracker> _services;
 
     /**
-     * @brief The InterfacesAdded match object
+     * @brief The EventLogQueue object that creates the event logs
      */
-    sdbusplus::match ifacesAddedMatch;
+    std::shared_ptr<EventLogQueue> _eventLogs;
 
     /**
      * @brief The current alarm values
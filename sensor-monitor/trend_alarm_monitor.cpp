@@ -0,0 +1,331 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#include "config.h"
+
+#include "trend_alarm_monitor.hpp"
+
+#include "json_config.hpp"
+
+#include <unistd.h>
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+
+namespace sensor::monitor
+{
+
+using namespace sdbusplus::xyz::openbmc_project::Logging::server;
+using namespace phosphor::fan;
+using json = nlohmann::json;
+
+constexpr auto confAppName = "sensor-monitor";
+constexpr auto confFileName = "trend_alarms.json";
+constexpr auto valueInterface = "xyz.openbmc_project.Sensor.Value";
+constexpr auto errorNameBase = "xyz.openbmc_project.Sensor.Threshold.Error.";
+
+const std::map<std::string, Entry::Level> severities{
+    {"Informational", Entry::Level::Informational},
+    {"Warning", Entry::Level::Warning},
+    {"Error", Entry::Level::Error},
+    {"Critical", Entry::Level::Critical}};
+
+TrendAlarmMonitor::TrendAlarmMonitor(std::shared_ptr<PowerState> powerState,
+                                     std::shared_ptr<EventLogQueue> eventLogs,
+                                     SignalDispatcher& dispatcher) :
+    _powerState(std::move(powerState)), _eventLogs(std::move(eventLogs))
+{
+    auto confFile = JsonConfig::getConfFile(confAppName, confFileName, true);
+    if (confFile.empty())
+    {
+        return;
+    }
+
+    try
+    {
+        _rules = getRules(JsonConfig::load(confFile));
+    }
+    catch (const std::exception& e)
+    {
+        // Don't take the other monitors down with a bad trend config.
+        lg2::error("Not monitoring sensor trends: {ERROR}", "ERROR", e);
+        return;
+    }
+
+    _powerState->addCallback("trendMon",
+                             std::bind(&TrendAlarmMonitor::powerStateChanged,
+                                       this, std::placeholders::_1));
+
+    dispatcher.addPropertiesHandler(
+        valueInterface,
+        [this](const std::string& path, const std::string&,
+               const PropertyMap& properties,
+               const std::string&) { valueChanged(path, properties); });
+
+    // One match per namespace, leaving out the ones inside another
+    // rule's namespace, so a signal is only handled once.
+    std::set<std::string> namespaces;
+    for (const auto& rule : _rules)
+    {
+        namespaces.insert(rule.pathNamespace);
+    }
+
+    for (const auto& pathNamespace : namespaces)
+    {
+        auto covered = std::ranges::any_of(
+            namespaces, [&pathNamespace](const auto& other) {
+                return (other != pathNamespace) &&
+                       inNamespace(pathNamespace, other);
+            });
+        if (!covered)
+        {
+            dispatcher.subscribe(valueInterface, pathNamespace);
+        }
+    }
+}
+
+bool TrendAlarmMonitor::inNamespace(const std::string& path,
+                                    const std::string& pathNamespace)
+{
+    return (path == pathNamespace) || (pathNamespace == "/") ||
+           path.starts_with(pathNamespace + '/');
+}
+
+std::vector<TrendRule> TrendAlarmMonitor::getRules(const json& config)
+{
+    std::vector<TrendRule> rules;
+
+    if (!config.contains("rules") || !config["rules"].is_array())
+    {
+        throw std::runtime_error{"Missing 'rules' array in trend config"};
+    }
+
+    for (const auto& jsonRule : config["rules"])
+    {
+        if (!jsonRule.contains("name") ||
+            !jsonRule.contains("path_namespace") ||
+            !jsonRule.contains("window") || !jsonRule.contains("thresholds"))
+        {
+            throw std::runtime_error{
+                "Trend rule needs a name, path_namespace, window, "
+                "and thresholds"};
+        }
+
+        TrendRule rule{jsonRule["name"].get<std::string>(),
+                       jsonRule["path_namespace"].get<std::string>(),
+                       std::chrono::seconds{jsonRule["window"].get<size_t>()},
+                       jsonRule.value("min_samples", 5u),
+                       {}};
+
+        if (rule.window.count() == 0)
+        {
+            throw std::runtime_error{"Trend rule " + rule.name +
+                                     " has a zero window"};
+        }
+
+        for (const auto& jsonThreshold : jsonRule["thresholds"])
+        {
+            if (!jsonThreshold.contains("rate") ||
+                !jsonThreshold.contains("severity"))
+            {
+                throw std::runtime_error{"Trend rule " + rule.name +
+                                         " threshold needs a rate and "
+                                         "severity"};
+            }
+
+            auto rate = jsonThreshold["rate"].get<double>();
+            auto clearRate = jsonThreshold.value("clear_rate", rate / 2);
+
+            auto severity =
+                severities.find(jsonThreshold["severity"].get<std::string>());
+
+            // The alarm has to clear at a rate past which it set.
+            if ((rate == 0.0) || ((rate > 0.0) && (clearRate > rate)) ||
+                ((rate < 0.0) && (clearRate < rate)) ||
+                (severity == severities.end()))
+            {
+                throw std::runtime_error{"Trend rule " + rule.name +
+                                         " has an invalid threshold"};
+            }
+
+            rule.thresholds.emplace_back(rate, clearRate, severity->second);
+        }
+
+        rules.push_back(std::move(rule));
+    }
+
+    return rules;
+}
+
+void TrendAlarmMonitor::valueChanged(const std::string& sensorPath,
+                                     const PropertyMap& properties)
+{
+#ifndef SKIP_POWER_CHECKING
+    if (!_powerState->isPowerOn())
+    {
+        return;
+    }
+#endif
+
+    auto property = properties.find("Value");
+    if ((property == properties.end()) ||
+        !std::holds_alternative<double>(property->second))
+    {
+        return;
+    }
+
+    auto value = std::get<double>(property->second);
+    if (!std::isfinite(value))
+    {
+        return;
+    }
+
+    auto now = TrendEstimator::Clock::now();
+    for (auto& trend : getTrends(sensorPath))
+    {
+        trend.estimator.add(now, value);
+
+        auto rate = trend.estimator.rate();
+        if (rate)
+        {
+            checkRate(sensorPath, trend, value, *rate);
+        }
+    }
+}
+
+std::vector<TrendAlarmMonitor::SensorTrend>&
+    TrendAlarmMonitor::getTrends(const std::string& sensorPath)
+{
+    auto trends = _trends.find(sensorPath);
+    if (trends != _trends.end())
+    {
+        return trends->second;
+    }
+
+    std::vector<SensorTrend> newTrends;
+    for (const auto& rule : _rules)
+    {
+        if (inNamespace(sensorPath, rule.pathNamespace))
+        {
+            newTrends.emplace_back(
+                &rule, TrendEstimator{rule.window, rule.minSamples},
+                std::vector<bool>(rule.thresholds.size(), false));
+        }
+    }
+
+    return _trends.emplace(sensorPath, std::move(newTrends)).first->second;
+}
+
+void TrendAlarmMonitor::checkRate(const std::string& sensorPath,
+                                  SensorTrend& trend, double value,
+                                  double rate)
+{
+    const auto& thresholds = trend.rule->thresholds;
+
+    for (size_t i = 0; i < thresholds.size(); i++)
+    {
+        const auto& threshold = thresholds[i];
+        bool rising = threshold.rate > 0.0;
+        bool alarm = trend.alarms[i];
+
+        if (!alarm)
+        {
+            alarm = rising ? (rate >= threshold.rate)
+                           : (rate <= threshold.rate);
+        }
+        else
+        {
+            alarm = rising ? (rate > threshold.clearRate)
+                           : (rate < threshold.clearRate);
+        }
+
+        if (alarm != trend.alarms[i])
+        {
+            trend.alarms[i] = alarm;
+            createEventLog(sensorPath, *trend.rule, i, alarm, value, rate);
+        }
+    }
+}
+
+void TrendAlarmMonitor::createEventLog(const std::string& sensorPath,
+                                       const TrendRule& rule, size_t index,
+                                       bool alarm, double value, double rate)
+{
+    const auto& threshold = rule.thresholds[index];
+
+    lg2::info("Trend Event {SENSOR_PATH} {RULE} rate {RATE}/min, threshold "
+              "{THRESHOLD}/min = {ALARM_VALUE}",
+              "SENSOR_PATH", sensorPath, "RULE", rule.name, "RATE", rate,
+              "THRESHOLD", threshold.rate, "ALARM_VALUE", alarm);
+
+    std::map<std::string, std::string> ad{
+        {"SENSOR_NAME", sensorPath},
+        {"SENSOR_VALUE", std::to_string(value)},
+        {"RATE_PER_MINUTE", std::to_string(rate)},
+        {"THRESHOLD_RATE_PER_MINUTE", std::to_string(threshold.rate)},
+        {"WINDOW_SECONDS", std::to_string(rule.window.count())},
+        {"TREND_RULE", rule.name},
+        {"_PID", std::to_string(getpid())}};
+
+    // The sensor type, like Temperature, from
+    // /xyz/openbmc_project/sensors/temperature/name
+    std::string type;
+    auto pos = sensorPath.find_last_of('/');
+    if ((pos != std::string::npos) && (pos > 0))
+    {
+        auto start = sensorPath.find_last_of('/', pos - 1);
+        type = sensorPath.substr(start + 1, pos - start - 1);
+        type.front() = toupper(type.front());
+    }
+
+    // Use the static threshold error names, with the ALARM_TYPE
+    // saying it is for the rate of change.
+    std::string errorName =
+        errorNameBase + type +
+        (threshold.severity == Entry::Level::Critical ? "Critical"
+                                                      : "Warning") +
+        (threshold.rate > 0 ? "High" : "Low") + (alarm ? "" : "Clear");
+    ad.emplace("ALARM_TYPE", "RateOfChange");
+
+    auto severity = alarm ? threshold.severity : Entry::Level::Informational;
+
+    _eventLogs->add(sensorPath + " " + rule.name + " " + std::to_string(index),
+                    alarm, errorName, convertForMessage(severity),
+                    std::move(ad));
+}
+
+void TrendAlarmMonitor::powerStateChanged(bool /*powerStateOn*/)
+{
+    for (auto& [path, trends] : _trends)
+    {
+        for (auto& trend : trends)
+        {
+            trend.estimator.clear();
+            std::fill(trend.alarms.begin(), trend.alarms.end(), false);
+        }
+    }
+}
+
+json TrendAlarmMonitor::getStats() const
+{
+    json stats = json::object();
+
+    for (const auto& [path, trends] : _trends)
+    {
+        for (const auto& trend : trends)
+        {
+            auto rate = trend.estimator.rate();
+            stats[path][trend.rule->name] = {
+                {"samples", trend.estimator.size()},
+                {"rate_per_minute", rate ? json(*rate) : json()},
+                {"alarms", trend.alarms}};
+        }
+    }
+
+    return stats;
+}
+
+} // namespace sensor::monitor
@@ -0,0 +1,209 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include "event_log_queue.hpp"
+#include "power_state.hpp"
+#include "signal_dispatcher.hpp"
+#include "trend_estimator.hpp"
+
+#include <nlohmann/json.hpp>
+#include <sdbusplus/bus.hpp>
+#include <xyz/openbmc_project/Logging/Entry/server.hpp>
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sensor::monitor
+{
+
+/**
+ * @brief One rate of change threshold of a trend rule
+ */
+struct TrendThreshold
+{
+    /**
+     * @brief The rate in units per minute that sets the alarm.  It is
+     *        for a rising value when positive and a falling value
+     *        when negative.
+     */
+    double rate;
+
+    /**
+     * @brief The rate the alarm clears at, closer to zero than rate
+     */
+    double clearRate;
+
+    /**
+     * @brief The event log severity when the alarm sets
+     */
+    sdbusplus::xyz::openbmc_project::Logging::server::Entry::Level severity;
+};
+
+/**
+ * @brief A trend alarm rule from the config file
+ */
+struct TrendRule
+{
+    std::string name;
+    std::string pathNamespace;
+    std::chrono::seconds window;
+    size_t minSamples;
+    std::vector<TrendThreshold> thresholds;
+};
+
+/**
+ * @class TrendAlarmMonitor
+ *
+ * Watches the Value property of the sensors covered by the rules in the
+ * optional trend_alarms.json config file and creates event logs when a
+ * sensor's rate of change crosses a rule's thresholds, which can be
+ * well before the value itself gets to a static threshold.
+ *
+ * Each sensor has a TrendEstimator for the rate for every rule that
+ * covers it, so a sample only costs a few additions and multiplications
+ * per rule.  The event logs use the static threshold error names, like:
+ *
+ * xyz.openbmc_project.Sensor.Threshold.Error.TemperatureWarningHigh
+ * xyz.openbmc_project.Sensor.Threshold.Error.TemperatureCriticalLowClear
+ *
+ * with Critical for Critical thresholds and Warning for the others, and
+ * an ALARM_TYPE of RateOfChange in the AdditionalData.  Samples are only
+ * used and event logs only created while the power is on.
+ */
+class TrendAlarmMonitor
+{
+  public:
+    TrendAlarmMonitor() = delete;
+    ~TrendAlarmMonitor() = default;
+    TrendAlarmMonitor(const TrendAlarmMonitor&) = delete;
+    TrendAlarmMonitor& operator=(const TrendAlarmMonitor&) = delete;
+    TrendAlarmMonitor(TrendAlarmMonitor&&) = delete;
+    TrendAlarmMonitor& operator=(TrendAlarmMonitor&&) = delete;
+
+    /**
+     * @brief Constructor
+     *
+     * Loads the config file, if there is one, and subscribes to
+     * the value changes of the sensors in it.
+     *
+     * @param[in] powerState - The PowerState object
+     * @param[in] eventLogs - The EventLogQueue object
+     * @param[in] dispatcher - The SignalDispatcher to get signals from
+     */
+    TrendAlarmMonitor(std::shared_ptr<phosphor::fan::PowerState> powerState,
+                      std::shared_ptr<EventLogQueue> eventLogs,
+                      SignalDispatcher& dispatcher);
+
+    /**
+     * @brief Parses the rules out of the JSON config.
+     *
+     * Throws std::runtime_error on an invalid config.
+     *
+     * @param[in] config - The config file contents
+     *
+     * @return std::vector<TrendRule> - The rules
+     */
+    static std::vector<TrendRule> getRules(const nlohmann::json& config);
+
+    /**
+     * @brief Returns the current rate and alarms of each sensor
+     *        for a dump.
+     */
+    nlohmann::json getStats() const;
+
+  private:
+    /**
+     * @brief Returns if a path is a path namespace or is under it
+     */
+    static bool inNamespace(const std::string& path,
+                            const std::string& pathNamespace);
+
+    /**
+     * @brief The trend state of a sensor for one rule
+     */
+    struct SensorTrend
+    {
+        const TrendRule* rule;
+        TrendEstimator estimator;
+        std::vector<bool> alarms;
+    };
+
+    /**
+     * @brief The PropertiesChanged handler for the Value interface.
+     *
+     * @param[in] sensorPath - The sensor object path
+     * @param[in] properties - The changed properties
+     */
+    void valueChanged(const std::string& sensorPath,
+                      const PropertyMap& properties);
+
+    /**
+     * @brief Returns the trend states of a sensor, one for each rule
+     *        that covers it, creating them the first time.
+     *
+     * @param[in] sensorPath - The sensor object path
+     */
+    std::vector<SensorTrend>& getTrends(const std::string& sensorPath);
+
+    /**
+     * @brief Sets or clears the alarms of a sensor based on its rate.
+     *
+     * @param[in] sensorPath - The sensor object path
+     * @param[in] trend - The sensor's trend state
+     * @param[in] value - The latest sensor value
+     * @param[in] rate - The rate of change in units per minute
+     */
+    void checkRate(const std::string& sensorPath, SensorTrend& trend,
+                   double value, double rate);
+
+    /**
+     * @brief Creates the event log for an alarm set or clear.
+     *
+     * @param[in] sensorPath - The sensor object path
+     * @param[in] rule - The rule
+     * @param[in] index - The index of the threshold in the rule
+     * @param[in] alarm - If the alarm set or cleared
+     * @param[in] value - The latest sensor value
+     * @param[in] rate - The rate of change in units per minute
+     */
+    void createEventLog(const std::string& sensorPath, const TrendRule& rule,
+                        size_t index, bool alarm, double value, double rate);
+
+    /**
+     * @brief The power state changed handler.
+     *
+     * Throws away the samples and alarms, since the sensors
+     * either stop updating or start from scratch.
+     *
+     * @param[in] powerStateOn - If the power is now on or off.
+     */
+    void powerStateChanged(bool powerStateOn);
+
+    /**
+     * @brief The PowerState object
+     */
+    std::shared_ptr<phosphor::fan::PowerState> _powerState;
+
+    /**
+     * @brief The EventLogQueue object
+     */
+    std::shared_ptr<EventLogQueue> _eventLogs;
+
+    /**
+     * @brief The rules from the config file
+     */
+    std::vector<TrendRule> _rules;
+
+    /**
+     * @brief The trend states of the sensors seen so far.  Sensors
+     *        not covered by a rule have an empty entry.
+     */
+    std::map<std::string, std::vector<SensorTrend>> _trends;
+};
+
+} // namespace sensor::monitor
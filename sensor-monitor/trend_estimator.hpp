@@ -0,0 +1,205 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <optional>
+
+namespace sensor::monitor
+{
+
+/**
+ * @class TrendEstimator
+ *
+ * Estimates how fast a sensor value is changing using a least squares
+ * line fit over the samples within a sliding time window.
+ *
+ * The sums the fit needs are updated as samples enter and leave the
+ * window, so adding a sample costs the same no matter how many are in
+ * it.  Times are kept relative to an origin that is moved up to the
+ * oldest sample now and then so the sums don't lose precision.
+ */
+class TrendEstimator
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    TrendEstimator() = delete;
+    ~TrendEstimator() = default;
+    TrendEstimator(const TrendEstimator&) = default;
+    TrendEstimator& operator=(const TrendEstimator&) = default;
+    TrendEstimator(TrendEstimator&&) = default;
+    TrendEstimator& operator=(TrendEstimator&&) = default;
+
+    /**
+     * @brief Constructor
+     *
+     * @param[in] window - How far back samples are used
+     * @param[in] minSamples - How many samples are needed before there
+     *                         is a rate
+     */
+    TrendEstimator(std::chrono::seconds window, size_t minSamples) :
+        _window(window), _minSamples(std::max<size_t>(minSamples, 2))
+    {}
+
+    /**
+     * @brief Adds a sample and drops the ones that have left the window.
+     *
+     * @param[in] time - When the value was read
+     * @param[in] value - The sensor value
+     */
+    void add(Clock::time_point time, double value)
+    {
+        if (_samples.empty())
+        {
+            _origin = time;
+        }
+
+        double t = seconds(time);
+
+        while (!_samples.empty() &&
+               (t - _samples.front().time > _window.count()))
+        {
+            remove(_samples.front());
+            _samples.pop_front();
+        }
+
+        // Move the origin up once the times get far enough from it.
+        if (!_samples.empty() && (_samples.front().time > _window.count()))
+        {
+            rebase();
+            t = seconds(time);
+        }
+
+        _samples.emplace_back(t, value);
+        _sumT += t;
+        _sumV += value;
+        _sumTT += t * t;
+        _sumTV += t * value;
+    }
+
+    /**
+     * @brief Returns the rate of change in units per minute, or nothing
+     *        if there aren't enough samples yet or they don't cover at
+     *        least half of the window.
+     */
+    std::optional<double> rate() const
+    {
+        if ((_samples.size() < _minSamples) ||
+            ((_samples.back().time - _samples.front().time) * 2 <
+             _window.count()))
+        {
+            return std::nullopt;
+        }
+
+        double n = _samples.size();
+        double denominator = n * _sumTT - _sumT * _sumT;
+        if (denominator <= 0.0)
+        {
+            return std::nullopt;
+        }
+
+        return (n * _sumTV - _sumT * _sumV) / denominator * 60.0;
+    }
+
+    /**
+     * @brief Drops all samples.
+     */
+    void clear()
+    {
+        _samples.clear();
+        _sumT = _sumV = _sumTT = _sumTV = 0.0;
+    }
+
+    /**
+     * @brief Returns the number of samples in the window
+     */
+    size_t size() const
+    {
+        return _samples.size();
+    }
+
+  private:
+    /**
+     * @brief A sample, with its time in seconds from _origin
+     */
+    struct Sample
+    {
+        double time;
+        double value;
+    };
+
+    /**
+     * @brief Converts a time to seconds from _origin.
+     */
+    double seconds(Clock::time_point time) const
+    {
+        return std::chrono::duration<double>(time - _origin).count();
+    }
+
+    /**
+     * @brief Takes a sample out of the sums.
+     */
+    void remove(const Sample& sample)
+    {
+        _sumT -= sample.time;
+        _sumV -= sample.value;
+        _sumTT -= sample.time * sample.time;
+        _sumTV -= sample.time * sample.value;
+    }
+
+    /**
+     * @brief Moves the origin to the oldest sample and recomputes the
+     *        sums, which also clears out accumulated rounding errors.
+     */
+    void rebase()
+    {
+        auto shift = std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(_samples.front().time));
+        _origin += shift;
+        double shiftSeconds = std::chrono::duration<double>(shift).count();
+
+        _sumT = _sumV = _sumTT = _sumTV = 0.0;
+        for (auto& sample : _samples)
+        {
+            sample.time -= shiftSeconds;
+            _sumT += sample.time;
+            _sumV += sample.value;
+            _sumTT += sample.time * sample.time;
+            _sumTV += sample.time * sample.value;
+        }
+    }
+
+    /**
+     * @brief How far back samples are used
+     */
+    std::chrono::seconds _window;
+
+    /**
+     * @brief How many samples are needed to have a rate
+     */
+    size_t _minSamples;
+
+    /**
+     * @brief The time the sample times are relative to
+     */
+    Clock::time_point _origin;
+
+    /**
+     * @brief The samples in the window, oldest first
+     */
+    std::deque<Sample> _samples;
+
+    /**
+     * @brief The running sums for the line fit
+     */
+    double _sumT = 0.0;
+    double _sumV = 0.0;
+    double _sumTT = 0.0;
+    double _sumTV = 0.0;
+};
+
+} // namespace sensor::monitor
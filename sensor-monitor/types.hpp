@@ -30,4 +30,8 @@ enum class AlarmType
 };
 
 using AlarmKey = std::tuple<std::string, ShutdownType, AlarmType>;
+
+using InterfaceName = std::string;
+using ObjectPath = std::string;
+using InterfaceKey = std::tuple<ObjectPath, InterfaceName>;
 } // namespace sensor::monitor
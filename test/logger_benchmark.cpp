@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#include "logger.hpp"
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+using namespace phosphor::fan;
+
+/**
+ * @brief Logging to a full log of state.range(0) entries, which should
+ *        take the same time at any size since the oldest entry is just
+ *        overwritten.
+ */
+static void BM_LoggerLogAtCapacity(benchmark::State& state)
+{
+    Logger logger{static_cast<size_t>(state.range(0))};
+    for (int64_t i = 0; i < state.range(0); i++)
+    {
+        logger.log("Fill", Logger::quiet);
+    }
+
+    for (auto _ : state)
+    {
+        // Short enough to not allocate, so only the logger is measured
+        logger.log("Fan 0 missing", Logger::quiet);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_LoggerLogAtCapacity)
+    ->RangeMultiplier(10)
+    ->Range(10, 100000)
+    ->Complexity(benchmark::o1);
+
+/**
+ * @brief Reading out a full log of state.range(0) entries, which is
+ *        where the timestamps are formatted.
+ */
+static void BM_LoggerGetLogs(benchmark::State& state)
+{
+    Logger logger{static_cast<size_t>(state.range(0))};
+    for (int64_t i = 0; i < state.range(0); i++)
+    {
+        logger.log("Fan " + std::to_string(i) + " missing", Logger::quiet);
+    }
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(logger.getLogs());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LoggerGetLogs)->RangeMultiplier(10)->Range(10, 1000);
+
+BENCHMARK_MAIN();
@@ -51,3 +51,33 @@ TEST(LoggerTest, Test)
     messages = logger.getLogs();
     EXPECT_TRUE(messages.empty());
 }
+
+TEST(LoggerTest, Wrap)
+{
+    const size_t logSize = 3;
+
+    Logger logger{logSize};
+
+    // Go around the ring a few times
+    for (int i = 0; i < 10; i++)
+    {
+        logger.log("Message "s + std::to_string(i), Logger::quiet);
+
+        auto messages = logger.getLogs();
+        ASSERT_EQ(messages.size(), std::min<size_t>(i + 1, logSize));
+        EXPECT_EQ((messages.back()[1].get<std::string>()),
+                  "Message "s + std::to_string(i));
+    }
+
+    auto messages = logger.getLogs();
+    EXPECT_EQ((messages[0][1].get<std::string>()), "Message 7");
+    EXPECT_EQ((messages[1][1].get<std::string>()), "Message 8");
+    EXPECT_EQ((messages[2][1].get<std::string>()), "Message 9");
+
+    // It starts over after a clear
+    logger.clear();
+    logger.log("After clear", Logger::quiet);
+    messages = logger.getLogs();
+    ASSERT_EQ(messages.size(), 1u);
+    EXPECT_EQ((messages[0][1].get<std::string>()), "After clear");
+}
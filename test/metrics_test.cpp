@@ -0,0 +1,62 @@
+#include "metrics.hpp"
+
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+using namespace phosphor::fan;
+using namespace std::chrono_literals;
+
+TEST(MetricsTest, Record)
+{
+    auto& metrics = Metrics::instance();
+    auto before = metrics.snapshot(Activity::signal);
+
+    metrics.record(Activity::signal, 1us);
+    metrics.record(Activity::signal, 3us);
+    metrics.record(Activity::signal, 1000us);
+    metrics.record(Activity::signal, 1h);
+
+    auto after = metrics.snapshot(Activity::signal);
+
+    EXPECT_EQ(after.count - before.count, 4u);
+    EXPECT_EQ(after.errors - before.errors, 0u);
+    EXPECT_EQ(after.maxUs, 3600000000u);
+    EXPECT_EQ(after.totalUs - before.totalUs, 3600001004u);
+
+    ASSERT_EQ(after.buckets.size(), Metrics::numBuckets);
+    EXPECT_EQ(after.buckets[0] - before.buckets[0], 1u);
+    EXPECT_EQ(after.buckets[2] - before.buckets[2], 1u);
+    EXPECT_EQ(after.buckets[10] - before.buckets[10], 1u);
+
+    // The last bucket takes anything longer
+    EXPECT_EQ(after.buckets[Metrics::numBuckets - 1] -
+                  before.buckets[Metrics::numBuckets - 1],
+              1u);
+
+    // The other activities are separate
+    EXPECT_EQ(metrics.snapshot(Activity::timer).maxUs, 0u);
+}
+
+TEST(MetricsTest, Timer)
+{
+    auto& metrics = Metrics::instance();
+    auto before = metrics.snapshot(Activity::dbusCall);
+
+    {
+        ActivityTimer timer{Activity::dbusCall};
+    }
+
+    try
+    {
+        ActivityTimer timer{Activity::dbusCall};
+        throw std::runtime_error{"Call failed"};
+    }
+    catch (const std::runtime_error&)
+    {}
+
+    auto after = metrics.snapshot(Activity::dbusCall);
+
+    EXPECT_EQ(after.count - before.count, 2u);
+    EXPECT_EQ(after.errors - before.errors, 1u);
+}
@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#include "dbus_interface.hpp"
+
+#include <string_view>
+
+namespace phosphor::fan::sim
+{
+
+/**
+ * @brief The D-Bus signature of each PropertyValue type, by index
+ */
+constexpr const char* signatures[] = {"b", "i", "x", "t", "d", "s"};
+static_assert(std::size(signatures) == std::variant_size_v<PropertyValue>);
+
+constexpr auto invalidArgument =
+    "xyz.openbmc_project.Common.Error.InvalidArgument";
+
+std::optional<PropertyValue> readVariant(sd_bus_message* msg)
+{
+    const char* contents = nullptr;
+    if (sd_bus_message_peek_type(msg, nullptr, &contents) < 0)
+    {
+        return std::nullopt;
+    }
+
+    sdbusplus::message_t m{msg};
+    std::string_view type{contents};
+
+    for (size_t i = 0; i < std::size(signatures); i++)
+    {
+        if (type == signatures[i])
+        {
+            PropertyValue value;
+            m.read(value);
+            return value;
+        }
+    }
+
+    sd_bus_message_skip(msg, "v");
+    return std::nullopt;
+}
+
+DBusInterface::DBusInterface(sdbusplus::bus_t& bus, const std::string& path,
+                             const std::string& interface,
+                             PropertyMap properties, WriteCallback callback) :
+    _bus(bus), _path(path), _name(interface),
+    _properties(std::move(properties)), _callback(std::move(callback))
+{
+    publish();
+}
+
+void DBusInterface::set(const std::string& name, const PropertyValue& value)
+{
+    auto it = _properties.find(name);
+    if (it == _properties.end())
+    {
+        _properties.emplace(name, value);
+        _interface.reset();
+        publish();
+    }
+    else if (it->second == value)
+    {
+        return;
+    }
+    else
+    {
+        it->second = value;
+    }
+
+    _interface->property_changed(name.c_str());
+}
+
+void DBusInterface::publish()
+{
+    _vtable.clear();
+    _vtable.push_back(sdbusplus::vtable::start());
+
+    for (const auto& [name, value] : _properties)
+    {
+        _vtable.push_back(sdbusplus::vtable::property(
+            name.c_str(), signatures[value.index()], getProperty, setProperty,
+            sdbusplus::vtable::property_::emits_change));
+    }
+
+    _vtable.push_back(sdbusplus::vtable::end());
+
+    _interface = std::make_unique<sdbusplus::server::interface_t>(
+        _bus, _path.c_str(), _name.c_str(), _vtable.data(), this);
+}
+
+int DBusInterface::getProperty(sd_bus*, const char*, const char*,
+                               const char* property, sd_bus_message* reply,
+                               void* context, sd_bus_error* error)
+{
+    auto self = static_cast<DBusInterface*>(context);
+
+    try
+    {
+        sdbusplus::message_t msg{reply};
+        std::visit([&msg](const auto& value) { msg.append(value); },
+                   self->_properties.at(property));
+    }
+    catch (const std::exception& e)
+    {
+        return sd_bus_error_set(error, invalidArgument, e.what());
+    }
+
+    return 1;
+}
+
+int DBusInterface::setProperty(sd_bus*, const char*, const char*,
+                               const char* property, sd_bus_message* value,
+                               void* context, sd_bus_error* error)
+{
+    auto self = static_cast<DBusInterface*>(context);
+
+    try
+    {
+        sdbusplus::message_t msg{value};
+        auto& current = self->_properties.at(property);
+
+        // Keep the type it was created with.
+        auto newValue = current;
+        std::visit([&msg](auto& v) { msg.read(v); }, newValue);
+
+        if (newValue != current)
+        {
+            current = newValue;
+            self->_interface->property_changed(property);
+        }
+
+        if (self->_callback)
+        {
+            self->_callback(property, current);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        return sd_bus_error_set(error, invalidArgument, e.what());
+    }
+
+    return 1;
+}
+
+} // namespace phosphor::fan::sim
@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include <systemd/sd-bus.h>
+
+#include <sdbusplus/bus.hpp>
+#include <sdbusplus/server/interface.hpp>
+#include <sdbusplus/vtable.hpp>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace phosphor::fan::sim
+{
+
+using PropertyValue =
+    std::variant<bool, int32_t, int64_t, uint64_t, double, std::string>;
+using PropertyMap = std::map<std::string, PropertyValue>;
+
+/**
+ * @brief Reads a variant out of a message, or skips it and returns
+ *        nothing if it isn't one of the PropertyValue types.
+ *
+ * @param[in] msg - The message, positioned at the variant
+ */
+std::optional<PropertyValue> readVariant(sd_bus_message* msg);
+
+/**
+ * @class DBusInterface
+ *
+ * Hosts a D-Bus interface made up of only properties, built at run time
+ * from the properties passed in, so the simulator can stand in for any
+ * of the services the fan applications talk to without generated
+ * bindings for each interface.
+ *
+ * Writes from other services are accepted if the new value has the
+ * same type, and the write callback is then called.
+ */
+class DBusInterface
+{
+  public:
+    using WriteCallback =
+        std::function<void(const std::string&, const PropertyValue&)>;
+
+    DBusInterface() = delete;
+    ~DBusInterface() = default;
+    DBusInterface(const DBusInterface&) = delete;
+    DBusInterface& operator=(const DBusInterface&) = delete;
+    DBusInterface(DBusInterface&&) = delete;
+    DBusInterface& operator=(DBusInterface&&) = delete;
+
+    /**
+     * @brief Constructor
+     *
+     * @param[in] bus - The sdbusplus bus object
+     * @param[in] path - The object path
+     * @param[in] interface - The interface name
+     * @param[in] properties - The properties and their starting values
+     * @param[in] callback - Called when another service writes
+     *                       a property
+     */
+    DBusInterface(sdbusplus::bus_t& bus, const std::string& path,
+                  const std::string& interface, PropertyMap properties,
+                  WriteCallback callback = {});
+
+    /**
+     * @brief Sets a property, emitting PropertiesChanged if it changed.
+     *
+     * A property that doesn't exist yet is added, which means the
+     * interface has to be put back on the bus with the new vtable.
+     *
+     * @param[in] name - The property name
+     * @param[in] value - The new value
+     */
+    void set(const std::string& name, const PropertyValue& value);
+
+    /**
+     * @brief Returns a property value.
+     */
+    const PropertyValue& get(const std::string& name) const
+    {
+        return _properties.at(name);
+    }
+
+    /**
+     * @brief Emits InterfacesAdded for the interface.
+     */
+    void emitAdded()
+    {
+        _interface->emit_added();
+    }
+
+  private:
+    /**
+     * @brief Builds the vtable from the properties and puts the
+     *        interface on the bus.
+     */
+    void publish();
+
+    static int getProperty(sd_bus* bus, const char* path,
+                           const char* interface, const char* property,
+                           sd_bus_message* reply, void* context,
+                           sd_bus_error* error);
+
+    static int setProperty(sd_bus* bus, const char* path,
+                           const char* interface, const char* property,
+                           sd_bus_message* value, void* context,
+                           sd_bus_error* error);
+
+    sdbusplus::bus_t& _bus;
+    std::string _path;
+    std::string _name;
+    PropertyMap _properties;
+    WriteCallback _callback;
+
+    /**
+     * @brief The vtable, which points into the keys of _properties
+     */
+    std::vector<sdbusplus::vtable_t> _vtable;
+
+    std::unique_ptr<sdbusplus::server::interface_t> _interface;
+};
+
+} // namespace phosphor::fan::sim
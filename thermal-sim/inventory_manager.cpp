@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#include "inventory_manager.hpp"
+
+#include <stdexcept>
+
+namespace phosphor::fan::sim
+{
+
+constexpr auto inventoryPath = "/xyz/openbmc_project/inventory";
+constexpr auto managerInterface = "xyz.openbmc_project.Inventory.Manager";
+constexpr auto invalidArgument =
+    "xyz.openbmc_project.Common.Error.InvalidArgument";
+
+const sdbusplus::vtable_t InventoryManager::_vtable[] = {
+    sdbusplus::vtable::start(),
+    sdbusplus::vtable::method("Notify", "a{oa{sa{sv}}}", "", notify),
+    sdbusplus::vtable::end()};
+
+namespace
+{
+
+void check(int rc)
+{
+    if (rc < 0)
+    {
+        throw std::runtime_error{"Could not read Notify arguments"};
+    }
+}
+
+std::string readString(sd_bus_message* msg, char type)
+{
+    const char* str = nullptr;
+    check(sd_bus_message_read_basic(msg, type, &str));
+    return str;
+}
+
+} // namespace
+
+InventoryManager::InventoryManager(sdbusplus::bus_t& bus,
+                                   NotifyCallback callback) :
+    _callback(std::move(callback)),
+    _interface(bus, inventoryPath, managerInterface, _vtable, this)
+{}
+
+int InventoryManager::notify(sd_bus_message* msg, void* context,
+                             sd_bus_error* error)
+{
+    auto self = static_cast<InventoryManager*>(context);
+
+    try
+    {
+        check(sd_bus_message_enter_container(msg, 'a', "{oa{sa{sv}}}"));
+        while (sd_bus_message_at_end(msg, false) == 0)
+        {
+            check(sd_bus_message_enter_container(msg, 'e', "oa{sa{sv}}"));
+            auto path = inventoryPath + readString(msg, 'o');
+
+            check(sd_bus_message_enter_container(msg, 'a', "{sa{sv}}"));
+            while (sd_bus_message_at_end(msg, false) == 0)
+            {
+                check(sd_bus_message_enter_container(msg, 'e', "sa{sv}"));
+                auto interface = readString(msg, 's');
+
+                PropertyMap properties;
+                check(sd_bus_message_enter_container(msg, 'a', "{sv}"));
+                while (sd_bus_message_at_end(msg, false) == 0)
+                {
+                    check(sd_bus_message_enter_container(msg, 'e', "sv"));
+                    auto name = readString(msg, 's');
+                    if (auto value = readVariant(msg))
+                    {
+                        properties.emplace(std::move(name), std::move(*value));
+                    }
+                    check(sd_bus_message_exit_container(msg));
+                }
+                check(sd_bus_message_exit_container(msg));
+                check(sd_bus_message_exit_container(msg));
+
+                self->_callback(path, interface, std::move(properties));
+            }
+            check(sd_bus_message_exit_container(msg));
+            check(sd_bus_message_exit_container(msg));
+        }
+        check(sd_bus_message_exit_container(msg));
+    }
+    catch (const std::exception& e)
+    {
+        return sd_bus_error_set(error, invalidArgument, e.what());
+    }
+
+    return sd_bus_reply_method_return(msg, "");
+}
+
+} // namespace phosphor::fan::sim
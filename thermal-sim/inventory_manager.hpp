@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include "dbus_interface.hpp"
+
+#include <systemd/sd-bus.h>
+
+#include <sdbusplus/bus.hpp>
+#include <sdbusplus/server/interface.hpp>
+#include <sdbusplus/vtable.hpp>
+
+#include <functional>
+#include <string>
+
+namespace phosphor::fan::sim
+{
+
+/**
+ * @class InventoryManager
+ *
+ * A stand in for the inventory manager's Notify method, which the
+ * presence and monitor applications use to update the Present and
+ * Functional properties of the fans.  The properties are handed to the
+ * callback with the full inventory path.  Properties of types other
+ * than the PropertyValue ones are dropped.
+ */
+class InventoryManager
+{
+  public:
+    using NotifyCallback =
+        std::function<void(const std::string& path,
+                           const std::string& interface, PropertyMap&&)>;
+
+    InventoryManager() = delete;
+    ~InventoryManager() = default;
+    InventoryManager(const InventoryManager&) = delete;
+    InventoryManager& operator=(const InventoryManager&) = delete;
+    InventoryManager(InventoryManager&&) = delete;
+    InventoryManager& operator=(InventoryManager&&) = delete;
+
+    /**
+     * @brief Constructor
+     *
+     * @param[in] bus - The sdbusplus bus object
+     * @param[in] callback - Called with each interface in a Notify
+     */
+    InventoryManager(sdbusplus::bus_t& bus, NotifyCallback callback);
+
+  private:
+    static int notify(sd_bus_message* msg, void* context,
+                      sd_bus_error* error);
+
+    static const sdbusplus::vtable_t _vtable[];
+
+    NotifyCallback _callback;
+
+    sdbusplus::server::interface_t _interface;
+};
+
+} // namespace phosphor::fan::sim
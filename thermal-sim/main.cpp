@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#include "scenario.hpp"
+#include "simulator.hpp"
+
+#include <CLI/CLI.hpp>
+#include <nlohmann/json.hpp>
+#include <sdbusplus/bus.hpp>
+#include <sdeventplus/event.hpp>
+#include <sdeventplus/source/signal.hpp>
+#include <stdplus/signal.hpp>
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+using namespace phosphor::fan::sim;
+using json = nlohmann::json;
+
+json loadJson(const std::string& file)
+{
+    std::ifstream stream{file};
+    if (!stream)
+    {
+        throw std::runtime_error{"Could not open " + file};
+    }
+    return json::parse(stream);
+}
+
+int main(int argc, char* argv[])
+{
+    CLI::App app{"Simulates the fans, sensors, and inventory the fan "
+                 "applications use, and how the temperatures respond"};
+
+    std::string configFile;
+    std::string scenarioFile;
+    std::string reportFile;
+
+    app.add_option("-c,--config", configFile, "The simulator config file")
+        ->required();
+    app.add_option("-s,--scenario", scenarioFile,
+                   "A scenario to run, after which the simulator exits");
+    app.add_option("-o,--output", reportFile,
+                   "Where to write the report instead of stdout");
+
+    try
+    {
+        app.parse(argc, argv);
+    }
+    catch (const CLI::Error& e)
+    {
+        return app.exit(e);
+    }
+
+    auto event = sdeventplus::Event::get_default();
+    auto bus = sdbusplus::bus::new_default();
+    bus.attach_event(event.get(), SD_EVENT_PRIORITY_NORMAL);
+
+    std::unique_ptr<Simulator> simulator;
+    try
+    {
+        std::optional<Scenario> scenario;
+        if (!scenarioFile.empty())
+        {
+            scenario.emplace(loadJson(scenarioFile));
+        }
+
+        simulator = std::make_unique<Simulator>(
+            bus, event, loadJson(configFile), std::move(scenario));
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+
+    auto stop = [&event](sdeventplus::source::Signal&,
+                         const struct signalfd_siginfo*) { event.exit(0); };
+
+    stdplus::signal::block(SIGINT);
+    stdplus::signal::block(SIGTERM);
+    sdeventplus::source::Signal sigInt{event, SIGINT, stop};
+    sdeventplus::source::Signal sigTerm{event, SIGTERM, stop};
+
+    auto rc = event.loop();
+
+    auto report = simulator->report();
+    if (reportFile.empty())
+    {
+        std::cout << std::setw(4) << report << "\n";
+    }
+    else
+    {
+        std::ofstream{reportFile} << std::setw(4) << report << "\n";
+    }
+
+    return rc;
+}
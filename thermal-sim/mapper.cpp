@@ -0,0 +1,167 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#include "mapper.hpp"
+
+#include <algorithm>
+
+namespace phosphor::fan::sim
+{
+
+constexpr auto mapperPath = "/xyz/openbmc_project/object_mapper";
+constexpr auto mapperInterface = "xyz.openbmc_project.ObjectMapper";
+constexpr auto notFound = "xyz.openbmc_project.Common.Error.ResourceNotFound";
+constexpr auto invalidArgument =
+    "xyz.openbmc_project.Common.Error.InvalidArgument";
+
+const sdbusplus::vtable_t Mapper::_vtable[] = {
+    sdbusplus::vtable::start(),
+    sdbusplus::vtable::method("GetObject", "sas", "a{sas}", getObject),
+    sdbusplus::vtable::method("GetSubTree", "sias", "a{sa{sas}}", getSubTree),
+    sdbusplus::vtable::method("GetSubTreePaths", "sias", "as",
+                              getSubTreePaths),
+    sdbusplus::vtable::end()};
+
+Mapper::Mapper(sdbusplus::bus_t& bus, const std::string& service) :
+    _service(service),
+    _interface(bus, mapperPath, mapperInterface, _vtable, this)
+{}
+
+Mapper::Interfaces Mapper::match(const std::set<std::string>& interfaces,
+                                 const Interfaces& wanted) const
+{
+    Interfaces matches;
+    std::copy_if(interfaces.begin(), interfaces.end(),
+                 std::back_inserter(matches), [&wanted](const auto& intf) {
+                     return wanted.empty() ||
+                            (std::find(wanted.begin(), wanted.end(), intf) !=
+                             wanted.end());
+                 });
+    return matches;
+}
+
+std::map<std::string, Mapper::Interfaces> Mapper::subtree(
+    const std::string& path, int32_t depth, const Interfaces& wanted) const
+{
+    std::map<std::string, Interfaces> paths;
+    auto prefix = (path == "/") ? path : path + '/';
+
+    for (const auto& [objPath, interfaces] : _objects)
+    {
+        if (!objPath.starts_with(prefix))
+        {
+            continue;
+        }
+
+        if (depth > 0)
+        {
+            auto levels = std::count(objPath.begin() + prefix.size() - 1,
+                                     objPath.end(), '/');
+            if (levels > depth)
+            {
+                continue;
+            }
+        }
+
+        auto matches = match(interfaces, wanted);
+        if (!matches.empty())
+        {
+            paths.emplace(objPath, std::move(matches));
+        }
+    }
+
+    return paths;
+}
+
+int Mapper::getObject(sd_bus_message* msg, void* context, sd_bus_error* error)
+{
+    auto self = static_cast<Mapper*>(context);
+
+    try
+    {
+        sdbusplus::message_t m{msg};
+        auto [path, wanted] = m.unpack<std::string, Interfaces>();
+
+        auto object = self->_objects.find(path);
+        if (object == self->_objects.end())
+        {
+            return sd_bus_error_set(error, notFound, path.c_str());
+        }
+
+        auto matches = self->match(object->second, wanted);
+        if (matches.empty())
+        {
+            return sd_bus_error_set(error, notFound, path.c_str());
+        }
+
+        auto reply = m.new_method_return();
+        reply.append(
+            std::map<std::string, Interfaces>{{self->_service, matches}});
+        reply.method_return();
+    }
+    catch (const std::exception& e)
+    {
+        return sd_bus_error_set(error, invalidArgument, e.what());
+    }
+
+    return 1;
+}
+
+int Mapper::getSubTree(sd_bus_message* msg, void* context, sd_bus_error* error)
+{
+    auto self = static_cast<Mapper*>(context);
+
+    try
+    {
+        sdbusplus::message_t m{msg};
+        auto [path, depth, wanted] =
+            m.unpack<std::string, int32_t, Interfaces>();
+
+        std::map<std::string, std::map<std::string, Interfaces>> result;
+        for (auto& [objPath, interfaces] : self->subtree(path, depth, wanted))
+        {
+            result[objPath].emplace(self->_service, std::move(interfaces));
+        }
+
+        auto reply = m.new_method_return();
+        reply.append(result);
+        reply.method_return();
+    }
+    catch (const std::exception& e)
+    {
+        return sd_bus_error_set(error, invalidArgument, e.what());
+    }
+
+    return 1;
+}
+
+int Mapper::getSubTreePaths(sd_bus_message* msg, void* context,
+                            sd_bus_error* error)
+{
+    auto self = static_cast<Mapper*>(context);
+
+    try
+    {
+        sdbusplus::message_t m{msg};
+        auto [path, depth, wanted] =
+            m.unpack<std::string, int32_t, Interfaces>();
+
+        std::vector<std::string> result;
+        for (const auto& [objPath, _] : self->subtree(path, depth, wanted))
+        {
+            result.push_back(objPath);
+        }
+
+        auto reply = m.new_method_return();
+        reply.append(result);
+        reply.method_return();
+    }
+    catch (const std::exception& e)
+    {
+        return sd_bus_error_set(error, invalidArgument, e.what());
+    }
+
+    return 1;
+}
+
+} // namespace phosphor::fan::sim
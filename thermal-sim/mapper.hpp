@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include <systemd/sd-bus.h>
+
+#include <sdbusplus/bus.hpp>
+#include <sdbusplus/server/interface.hpp>
+#include <sdbusplus/vtable.hpp>
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace phosphor::fan::sim
+{
+
+/**
+ * @class Mapper
+ *
+ * A stand in for the object mapper, answering GetObject, GetSubTree,
+ * and GetSubTreePaths for the objects the simulator hosts, which are
+ * the only ones it knows about.
+ */
+class Mapper
+{
+  public:
+    Mapper() = delete;
+    ~Mapper() = default;
+    Mapper(const Mapper&) = delete;
+    Mapper& operator=(const Mapper&) = delete;
+    Mapper(Mapper&&) = delete;
+    Mapper& operator=(Mapper&&) = delete;
+
+    /**
+     * @brief Constructor
+     *
+     * @param[in] bus - The sdbusplus bus object
+     * @param[in] service - The service name to return for every object
+     */
+    Mapper(sdbusplus::bus_t& bus, const std::string& service);
+
+    /**
+     * @brief Adds an interface on a path.
+     */
+    void add(const std::string& path, const std::string& interface)
+    {
+        _objects[path].insert(interface);
+    }
+
+  private:
+    using Interfaces = std::vector<std::string>;
+
+    /**
+     * @brief Returns the interfaces on a path that are in the list,
+     *        or all of them when the list is empty.
+     */
+    Interfaces match(const std::set<std::string>& interfaces,
+                     const Interfaces& wanted) const;
+
+    /**
+     * @brief Returns the paths under a subtree, down to a depth,
+     *        with the interfaces wanted.
+     */
+    std::map<std::string, Interfaces> subtree(const std::string& path,
+                                              int32_t depth,
+                                              const Interfaces& wanted) const;
+
+    static int getObject(sd_bus_message* msg, void* context,
+                         sd_bus_error* error);
+
+    static int getSubTree(sd_bus_message* msg, void* context,
+                          sd_bus_error* error);
+
+    static int getSubTreePaths(sd_bus_message* msg, void* context,
+                               sd_bus_error* error);
+
+    static const sdbusplus::vtable_t _vtable[];
+
+    /**
+     * @brief The service name to return for every object
+     */
+    std::string _service;
+
+    /**
+     * @brief The interfaces on each path
+     */
+    std::map<std::string, std::set<std::string>> _objects;
+
+    sdbusplus::server::interface_t _interface;
+};
+
+} // namespace phosphor::fan::sim
@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#include "scenario.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace phosphor::fan::sim
+{
+
+using json = nlohmann::json;
+
+Scenario::Scenario(const json& config) :
+    _duration(config.at("duration").get<double>()),
+    _stableBand(config.value("stable_band", 0.5)),
+    _stableHold(config.value("stable_hold", 30.0))
+{
+    for (const auto& jsonStep : config.value("steps", json::array()))
+    {
+        ScenarioStep step;
+        step.at = jsonStep.at("at").get<double>();
+        step.name = jsonStep.value("name", "step " +
+                                               std::to_string(_steps.size()));
+        step.loads =
+            jsonStep.value("loads", std::map<std::string, double>{});
+        if (jsonStep.contains("ambient"))
+        {
+            step.ambient = jsonStep["ambient"].get<double>();
+        }
+        step.fail = jsonStep.value("fail", std::vector<std::string>{});
+        step.repair = jsonStep.value("repair", std::vector<std::string>{});
+
+        _steps.push_back(std::move(step));
+    }
+
+    if (_steps.empty() || (_steps.front().at != 0.0))
+    {
+        _steps.insert(_steps.begin(), ScenarioStep{"start", 0.0, {}, {}, {},
+                                                   {}});
+    }
+
+    std::stable_sort(_steps.begin(), _steps.end(),
+                     [](const auto& a, const auto& b) { return a.at < b.at; });
+
+    if ((_duration <= 0.0) || (_steps.back().at >= _duration))
+    {
+        throw std::runtime_error{
+            "Scenario steps have to be before the end of its duration"};
+    }
+}
+
+void Scenario::applySteps(double time, ThermalModel& model)
+{
+    for (; (_applied < _steps.size()) && (_steps[_applied].at <= time);
+         _applied++)
+    {
+        const auto& step = _steps[_applied];
+
+        for (const auto& [sensor, load] : step.loads)
+        {
+            model.setLoad(sensor, load);
+        }
+
+        if (step.ambient)
+        {
+            model.setAmbient(*step.ambient);
+        }
+
+        for (const auto& fan : step.fail)
+        {
+            model.setFailed(fan, true);
+        }
+
+        for (const auto& fan : step.repair)
+        {
+            model.setFailed(fan, false);
+        }
+    }
+}
+
+json Scenario::analyze() const
+{
+    json steps = json::array();
+
+    for (size_t i = 0; i < _steps.size(); i++)
+    {
+        auto end = (i + 1 < _steps.size()) ? _steps[i + 1].at : _duration;
+        steps.push_back(analyzeStep(_steps[i], end));
+    }
+
+    return steps;
+}
+
+json Scenario::analyzeStep(const ScenarioStep& step, double end) const
+{
+    json result{{"name", step.name}, {"at", step.at}};
+
+    auto first =
+        std::find_if(_samples.begin(), _samples.end(),
+                     [&step](const auto& s) { return s.time >= step.at; });
+    auto last = std::find_if(first, _samples.end(),
+                             [end](const auto& s) { return s.time >= end; });
+
+    if (first == last)
+    {
+        result["time_to_stable_s"] = nullptr;
+        return result;
+    }
+
+    const auto& start = *first;
+    const auto& final = *(last - 1);
+
+    // The first sample after which every temperature stays in the band.
+    auto stable = last;
+    while ((stable != first) &&
+           std::all_of(start.temperatures.begin(), start.temperatures.end(),
+                       [&stable, &final, this](const auto& entry) {
+                           const auto& name = entry.first;
+                           return std::abs((stable - 1)->temperatures.at(name) -
+                                           final.temperatures.at(name)) <=
+                                  _stableBand;
+                       }))
+    {
+        --stable;
+    }
+
+    if ((stable != last) && (end - stable->time >= _stableHold))
+    {
+        result["time_to_stable_s"] = stable->time - step.at;
+    }
+    else
+    {
+        result["time_to_stable_s"] = nullptr;
+    }
+
+    auto& temperatures = result["temperatures"] = json::object();
+    for (const auto& [name, startTemp] : start.temperatures)
+    {
+        auto finalTemp = final.temperatures.at(name);
+        double peak = startTemp;
+        double low = startTemp;
+
+        for (auto s = first; s != last; ++s)
+        {
+            peak = std::max(peak, s->temperatures.at(name));
+            low = std::min(low, s->temperatures.at(name));
+        }
+
+        auto overshoot =
+            (finalTemp >= startTemp) ? (peak - finalTemp) : (finalTemp - low);
+
+        temperatures[name] = {{"start", startTemp},
+                              {"end", finalTemp},
+                              {"peak", peak},
+                              {"overshoot", overshoot}};
+    }
+
+    size_t changes = 0;
+    for (auto s = first + 1; s < last; ++s)
+    {
+        if (s->targets != (s - 1)->targets)
+        {
+            changes++;
+        }
+    }
+    result["target_changes"] = changes;
+
+    auto& targets = result["targets"] = json::object();
+    for (const auto& [fan, target] : final.targets)
+    {
+        targets[fan] = target;
+    }
+
+    return result;
+}
+
+} // namespace phosphor::fan::sim
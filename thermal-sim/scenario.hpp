@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include "thermal_model.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace phosphor::fan::sim
+{
+
+/**
+ * @brief A change to the simulated system partway through a scenario
+ */
+struct ScenarioStep
+{
+    std::string name;
+
+    /**
+     * @brief Seconds from the start of the scenario
+     */
+    double at = 0.0;
+
+    std::map<std::string, double> loads;
+    std::optional<double> ambient;
+    std::vector<std::string> fail;
+    std::vector<std::string> repair;
+};
+
+/**
+ * @brief The state of the simulated system at a point in time
+ */
+struct Sample
+{
+    /**
+     * @brief Seconds from the start of the scenario
+     */
+    double time = 0.0;
+
+    std::map<std::string, double> temperatures;
+    std::map<std::string, double> targets;
+};
+
+/**
+ * @class Scenario
+ *
+ * A script of load, ambient, and fan failure changes to put the fan
+ * applications through, and the analysis of how the temperatures
+ * responded to each of them.
+ *
+ * For each step, the temperatures are considered stable once they stay
+ * within the stable band of where they end up for at least the stable
+ * hold time.  The overshoot is how far a temperature went past where
+ * it ended up, in the direction it was heading.
+ */
+class Scenario
+{
+  public:
+    Scenario() = delete;
+    ~Scenario() = default;
+    Scenario(const Scenario&) = delete;
+    Scenario& operator=(const Scenario&) = delete;
+    Scenario(Scenario&&) = default;
+    Scenario& operator=(Scenario&&) = default;
+
+    /**
+     * @brief Constructor
+     *
+     * Throws std::runtime_error on an invalid scenario.
+     *
+     * @param[in] config - The scenario JSON
+     */
+    explicit Scenario(const nlohmann::json& config);
+
+    /**
+     * @brief Applies the steps that are due by the time passed in
+     *        and haven't been applied yet.
+     *
+     * @param[in] time - Seconds from the start of the scenario
+     * @param[in] model - The model to change
+     */
+    void applySteps(double time, ThermalModel& model);
+
+    /**
+     * @brief Adds a sample for the analysis.
+     */
+    void addSample(Sample&& sample)
+    {
+        _samples.push_back(std::move(sample));
+    }
+
+    /**
+     * @brief Returns if the scenario has run its full duration.
+     *
+     * @param[in] time - Seconds from the start of the scenario
+     */
+    bool done(double time) const
+    {
+        return time >= _duration;
+    }
+
+    /**
+     * @brief Returns the analysis of each step.
+     */
+    nlohmann::json analyze() const;
+
+  private:
+    /**
+     * @brief Returns the analysis of the samples between two times.
+     */
+    nlohmann::json analyzeStep(const ScenarioStep& step, double end) const;
+
+    /**
+     * @brief The steps, in time order
+     */
+    std::vector<ScenarioStep> _steps;
+
+    /**
+     * @brief The number of steps applied so far
+     */
+    size_t _applied = 0;
+
+    /**
+     * @brief How many seconds the scenario runs for
+     */
+    double _duration;
+
+    /**
+     * @brief How close to its final value a temperature has to stay
+     *        to be stable
+     */
+    double _stableBand;
+
+    /**
+     * @brief How many seconds it has to stay there
+     */
+    double _stableHold;
+
+    std::vector<Sample> _samples;
+};
+
+} // namespace phosphor::fan::sim
@@ -0,0 +1,375 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#include "simulator.hpp"
+
+#include <unistd.h>
+
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+namespace phosphor::fan::sim
+{
+
+using json = nlohmann::json;
+using Clock = std::chrono::steady_clock;
+
+constexpr auto serviceName = "xyz.openbmc_project.ThermalSim";
+constexpr auto mapperName = "xyz.openbmc_project.ObjectMapper";
+constexpr auto inventoryName = "xyz.openbmc_project.Inventory.Manager";
+
+constexpr auto tachPath = "/xyz/openbmc_project/sensors/fan_tach/";
+constexpr auto tempPath = "/xyz/openbmc_project/sensors/temperature/";
+constexpr auto inventoryPath = "/xyz/openbmc_project/inventory";
+
+constexpr auto valueInterface = "xyz.openbmc_project.Sensor.Value";
+constexpr auto fanSpeedInterface = "xyz.openbmc_project.Control.FanSpeed";
+constexpr auto fanPwmInterface = "xyz.openbmc_project.Control.FanPwm";
+constexpr auto statusInterface =
+    "xyz.openbmc_project.State.Decorator.OperationalStatus";
+constexpr auto itemInterface = "xyz.openbmc_project.Inventory.Item";
+
+namespace
+{
+
+/**
+ * @brief Converts a JSON value from the config 'objects' section.
+ */
+PropertyValue toPropertyValue(const json& value)
+{
+    if (value.is_boolean())
+    {
+        return value.get<bool>();
+    }
+    if (value.is_number_float())
+    {
+        return value.get<double>();
+    }
+    if (value.is_number_integer())
+    {
+        auto number = value.get<int64_t>();
+        if ((number >= std::numeric_limits<int32_t>::min()) &&
+            (number <= std::numeric_limits<int32_t>::max()))
+        {
+            return static_cast<int32_t>(number);
+        }
+        return number;
+    }
+    if (value.is_string())
+    {
+        return value.get<std::string>();
+    }
+
+    throw std::runtime_error{"Unsupported property value " + value.dump()};
+}
+
+} // namespace
+
+Simulator::Simulator(sdbusplus::bus_t& bus, const sdeventplus::Event& event,
+                     const json& config, std::optional<Scenario> scenario) :
+    _bus(bus), _event(event), _model(config), _scenario(std::move(scenario)),
+    _mapper(bus, serviceName),
+    _inventoryManager(bus,
+                      [this](const auto& path, const auto& interface,
+                             auto&& properties) {
+                          notified(path, interface, std::move(properties));
+                      }),
+    _objectManager(bus, "/"),
+    _tickInterval(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::duration<double>(config.value("tick", 1.0)))),
+    _timer(event, std::bind(&Simulator::tick, this))
+{
+    for (const auto& fan : _model.fans())
+    {
+        for (const auto& sensor : fan.sensors)
+        {
+            auto path = tachPath + sensor;
+            addInterface(path, valueInterface, {{"Value", fan.speed}});
+            addInterface(
+                path, fan.pwm ? fanPwmInterface : fanSpeedInterface,
+                {{"Target", static_cast<uint64_t>(fan.target)}},
+                [this, name = fan.name](const auto&, const auto& value) {
+                    _targetWrites++;
+                    _model.setTarget(name, std::get<uint64_t>(value));
+                });
+            addInterface(path, statusInterface, {{"Functional", true}});
+        }
+
+        auto path = inventoryPath + fan.inventory;
+        addInterface(path, itemInterface,
+                     {{"Present", true}, {"PrettyName", fan.name}});
+        addInterface(path, statusInterface, {{"Functional", true}});
+    }
+
+    for (const auto& temp : _model.temperatures())
+    {
+        addInterface(tempPath + temp.name, valueInterface,
+                     {{"Value", temp.temperature}});
+    }
+
+    auto objects = config.value("objects", json::object());
+    if (!objects.contains("/org/openbmc/control/power0"))
+    {
+        objects["/org/openbmc/control/power0"] = {
+            {"org.openbmc.control.Power", {{"pgood", 1}, {"state", 1}}}};
+    }
+
+    for (const auto& [path, interfaces] : objects.items())
+    {
+        for (const auto& [interface, properties] : interfaces.items())
+        {
+            PropertyMap props;
+            for (const auto& [name, value] : properties.items())
+            {
+                props.emplace(name, toPropertyValue(value));
+            }
+            addInterface(path, interface, std::move(props));
+        }
+    }
+
+    auto rc = sd_bus_add_filter(_bus.get(), &_filterSlot, countCall, this);
+    if (rc < 0)
+    {
+        throw std::runtime_error{"Could not add the D-Bus filter"};
+    }
+
+    _bus.request_name(serviceName);
+    _bus.request_name(mapperName);
+    _bus.request_name(inventoryName);
+
+    _start = _lastTick = Clock::now();
+    _timer.restart(_tickInterval);
+}
+
+Simulator::~Simulator()
+{
+    sd_bus_slot_unref(_filterSlot);
+}
+
+DBusInterface& Simulator::addInterface(const std::string& path,
+                                       const std::string& interface,
+                                       PropertyMap properties,
+                                       DBusInterface::WriteCallback callback)
+{
+    _mapper.add(path, interface);
+
+    auto& intf = _interfaces[{path, interface}];
+    intf = std::make_unique<DBusInterface>(
+        _bus, path, interface, std::move(properties), std::move(callback));
+    return *intf;
+}
+
+void Simulator::tick()
+{
+    auto now = Clock::now();
+    auto time = std::chrono::duration<double>(now - _start).count();
+
+    if (_scenario)
+    {
+        _scenario->applySteps(time, _model);
+    }
+
+    _model.step(now - _lastTick);
+    _lastTick = now;
+
+    updateSensors();
+    findClientProcesses();
+
+    if (_scenario)
+    {
+        Sample sample;
+        sample.time = time;
+        for (const auto& temp : _model.temperatures())
+        {
+            sample.temperatures[temp.name] = temp.temperature;
+        }
+        for (const auto& fan : _model.fans())
+        {
+            sample.targets[fan.name] = fan.target;
+        }
+        _scenario->addSample(std::move(sample));
+
+        if (_scenario->done(time))
+        {
+            _event.exit(0);
+        }
+    }
+}
+
+void Simulator::updateSensors()
+{
+    for (const auto& fan : _model.fans())
+    {
+        for (const auto& sensor : fan.sensors)
+        {
+            _interfaces.at({tachPath + sensor, valueInterface})
+                ->set("Value", std::round(fan.speed));
+        }
+    }
+
+    for (const auto& temp : _model.temperatures())
+    {
+        // Like hwmon, which reports in millidegrees.
+        _interfaces.at({tempPath + temp.name, valueInterface})
+            ->set("Value", std::round(temp.temperature * 1000.0) / 1000.0);
+    }
+}
+
+void Simulator::notified(const std::string& path, const std::string& interface,
+                         PropertyMap&& properties)
+{
+    auto it = _interfaces.find({path, interface});
+    if (it == _interfaces.end())
+    {
+        addInterface(path, interface, std::move(properties)).emitAdded();
+        return;
+    }
+
+    for (const auto& [name, value] : properties)
+    {
+        it->second->set(name, value);
+    }
+}
+
+void Simulator::findClientProcesses()
+{
+    for (auto& [uniqueName, client] : _clients)
+    {
+        if (client.pid != 0)
+        {
+            continue;
+        }
+
+        try
+        {
+            auto msg = _bus.new_method_call(
+                "org.freedesktop.DBus", "/org/freedesktop/DBus",
+                "org.freedesktop.DBus", "GetConnectionUnixProcessID");
+            msg.append(uniqueName);
+            client.pid = _bus.call(msg).unpack<uint32_t>();
+        }
+        catch (const std::exception&)
+        {
+            // It already went away.
+            client.pid = -1;
+            continue;
+        }
+
+        std::ifstream comm{"/proc/" + std::to_string(client.pid) + "/comm"};
+        std::getline(comm, client.name);
+        client.startTicks = cpuTicks(client.pid);
+    }
+}
+
+std::optional<uint64_t> Simulator::cpuTicks(pid_t pid)
+{
+    std::ifstream file{"/proc/" + std::to_string(pid) + "/stat"};
+    std::string stat;
+    if (!std::getline(file, stat))
+    {
+        return std::nullopt;
+    }
+
+    // The fields after the command name, which can have spaces in it,
+    // start with the state.  utime and stime are the 12th and 13th.
+    auto pos = stat.rfind(')');
+    if (pos == std::string::npos)
+    {
+        return std::nullopt;
+    }
+
+    std::istringstream fields{stat.substr(pos + 2)};
+    std::string field;
+    uint64_t utime = 0;
+    uint64_t stime = 0;
+    for (int i = 0; i < 11; i++)
+    {
+        fields >> field;
+    }
+    if (!(fields >> utime >> stime))
+    {
+        return std::nullopt;
+    }
+
+    return utime + stime;
+}
+
+int Simulator::countCall(sd_bus_message* msg, void* context, sd_bus_error*)
+{
+    auto self = static_cast<Simulator*>(context);
+
+    uint8_t type = 0;
+    sd_bus_message_get_type(msg, &type);
+    const char* sender = sd_bus_message_get_sender(msg);
+    const char* member = sd_bus_message_get_member(msg);
+
+    if ((type == SD_BUS_MESSAGE_METHOD_CALL) && (sender != nullptr))
+    {
+        auto [it, added] = self->_clients.try_emplace(sender);
+        if (added)
+        {
+            it->second.name = sender;
+            it->second.firstSeen = Clock::now();
+        }
+
+        it->second.calls++;
+        it->second.methods[member ? member : ""]++;
+    }
+
+    // Let the message go on to be handled.
+    return 0;
+}
+
+json Simulator::report()
+{
+    auto now = Clock::now();
+    auto seconds = std::chrono::duration<double>(now - _start).count();
+    auto ticksPerSecond = sysconf(_SC_CLK_TCK);
+
+    json report;
+    report["duration_s"] = seconds;
+    report["target_writes"] = _targetWrites;
+    report["target_writes_per_s"] = _targetWrites / seconds;
+
+    if (_scenario)
+    {
+        report["steps"] = _scenario->analyze();
+    }
+
+    size_t calls = 0;
+    auto& clients = report["clients"] = json::array();
+    for (const auto& [uniqueName, client] : _clients)
+    {
+        auto clientSeconds =
+            std::chrono::duration<double>(now - client.firstSeen).count();
+
+        json entry{{"name", client.name},
+                   {"bus_name", uniqueName},
+                   {"pid", client.pid},
+                   {"calls", client.calls},
+                   {"calls_per_s", client.calls / clientSeconds},
+                   {"methods", client.methods},
+                   {"cpu_percent", nullptr}};
+
+        if (client.startTicks && (client.pid > 0))
+        {
+            if (auto ticks = cpuTicks(client.pid); ticks)
+            {
+                entry["cpu_percent"] = (*ticks - *client.startTicks) * 100.0 /
+                                       ticksPerSecond / clientSeconds;
+            }
+        }
+
+        calls += client.calls;
+        clients.push_back(std::move(entry));
+    }
+
+    report["calls"] = calls;
+    report["calls_per_s"] = calls / seconds;
+
+    return report;
+}
+
+} // namespace phosphor::fan::sim
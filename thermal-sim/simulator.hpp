@@ -0,0 +1,181 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include "dbus_interface.hpp"
+#include "inventory_manager.hpp"
+#include "mapper.hpp"
+#include "scenario.hpp"
+#include "thermal_model.hpp"
+
+#include <sys/types.h>
+#include <systemd/sd-bus.h>
+
+#include <nlohmann/json.hpp>
+#include <sdbusplus/bus.hpp>
+#include <sdbusplus/server/manager.hpp>
+#include <sdeventplus/clock.hpp>
+#include <sdeventplus/event.hpp>
+#include <sdeventplus/utility/timer.hpp>
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace phosphor::fan::sim
+{
+
+/**
+ * @class Simulator
+ *
+ * Puts a ThermalModel on D-Bus so the fan applications can run against
+ * it unchanged on a private bus.  It hosts:
+ *
+ *  - The fan tach sensors, with their Value, Target, and Functional
+ *    properties.  Target writes change the model's fan targets.
+ *  - The temperature sensors.
+ *  - The fan inventory items, along with the inventory manager's
+ *    Notify method to update them.
+ *  - The pgood property, and any other objects in the config.
+ *  - An object mapper that knows about all of the above.
+ *
+ * Every tick it advances the model, updates the sensor values, and
+ * if there is a scenario, applies its steps and samples the results.
+ *
+ * It also counts the method calls each client makes and, from the
+ * client's process, how much CPU time it uses while the simulator is
+ * running, to report the D-Bus and CPU cost of each application.
+ */
+class Simulator
+{
+  public:
+    Simulator() = delete;
+    Simulator(const Simulator&) = delete;
+    Simulator& operator=(const Simulator&) = delete;
+    Simulator(Simulator&&) = delete;
+    Simulator& operator=(Simulator&&) = delete;
+
+    /**
+     * @brief Constructor
+     *
+     * Throws std::runtime_error on an invalid config.
+     *
+     * @param[in] bus - The sdbusplus bus object
+     * @param[in] event - The event loop, which is exited when the
+     *                    scenario is done
+     * @param[in] config - The simulator config
+     * @param[in] scenario - The optional scenario to run
+     */
+    Simulator(sdbusplus::bus_t& bus, const sdeventplus::Event& event,
+              const nlohmann::json& config, std::optional<Scenario> scenario);
+
+    ~Simulator();
+
+    /**
+     * @brief Returns the scenario analysis and the cost of each client.
+     */
+    nlohmann::json report();
+
+  private:
+    /**
+     * @brief What is known about a client of the simulator
+     */
+    struct Client
+    {
+        std::string name;
+        pid_t pid = 0;
+        size_t calls = 0;
+        std::map<std::string, size_t> methods;
+
+        /**
+         * @brief When it was first seen, and its CPU ticks then
+         */
+        std::chrono::steady_clock::time_point firstSeen;
+        std::optional<uint64_t> startTicks;
+    };
+
+    /**
+     * @brief Hosts an interface and adds it to the mapper.
+     */
+    DBusInterface& addInterface(const std::string& path,
+                                const std::string& interface,
+                                PropertyMap properties,
+                                DBusInterface::WriteCallback callback = {});
+
+    /**
+     * @brief Advances the model and updates the sensors.
+     */
+    void tick();
+
+    /**
+     * @brief Updates the sensor values from the model.
+     */
+    void updateSensors();
+
+    /**
+     * @brief The Notify handler, which updates or adds
+     *        an inventory interface.
+     */
+    void notified(const std::string& path, const std::string& interface,
+                  PropertyMap&& properties);
+
+    /**
+     * @brief Finds the process of each client that doesn't have one
+     *        yet, to be able to get its CPU usage.
+     */
+    void findClientProcesses();
+
+    /**
+     * @brief Returns the user plus system CPU ticks of a process.
+     */
+    static std::optional<uint64_t> cpuTicks(pid_t pid);
+
+    /**
+     * @brief The bus filter that counts the method calls of each client.
+     */
+    static int countCall(sd_bus_message* msg, void* context,
+                         sd_bus_error* error);
+
+    sdbusplus::bus_t& _bus;
+    sdeventplus::Event _event;
+    ThermalModel _model;
+    std::optional<Scenario> _scenario;
+
+    Mapper _mapper;
+    InventoryManager _inventoryManager;
+    sdbusplus::server::manager_t _objectManager;
+
+    /**
+     * @brief The hosted interfaces, by path and interface
+     */
+    std::map<std::pair<std::string, std::string>,
+             std::unique_ptr<DBusInterface>>
+        _interfaces;
+
+    /**
+     * @brief How often the model is advanced
+     */
+    std::chrono::milliseconds _tickInterval;
+
+    std::chrono::steady_clock::time_point _start;
+    std::chrono::steady_clock::time_point _lastTick;
+
+    /**
+     * @brief The number of Target writes
+     */
+    size_t _targetWrites = 0;
+
+    /**
+     * @brief The clients, by unique name
+     */
+    std::map<std::string, Client> _clients;
+
+    sd_bus_slot* _filterSlot = nullptr;
+
+    sdeventplus::utility::Timer<sdeventplus::ClockId::Monotonic> _timer;
+};
+
+} // namespace phosphor::fan::sim
@@ -0,0 +1,158 @@
+#include "../scenario.hpp"
+#include "../thermal_model.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace phosphor::fan::sim;
+using namespace std::chrono_literals;
+using json = nlohmann::json;
+
+namespace
+{
+
+const json config = R"(
+{
+    "ambient": 25.0,
+    "fans": [
+        {
+            "name": "fan0",
+            "sensors": ["fan0_0", "fan0_1"],
+            "max_speed": 10000,
+            "time_constant": 1.0,
+            "initial_target": 5000
+        },
+        {
+            "name": "fan1",
+            "target_interface": "PWM",
+            "max_speed": 8000,
+            "time_constant": 0
+        }
+    ],
+    "temperatures": [
+        {
+            "name": "cpu0",
+            "load": 100,
+            "conductance": 2.0,
+            "cooling": {"fan0": 4.0, "fan1": 4.0},
+            "time_constant": 10
+        }
+    ]
+}
+)"_json;
+
+} // namespace
+
+TEST(ThermalModelTest, SteadyStateTest)
+{
+    ThermalModel model{config};
+
+    ASSERT_EQ(model.fans().size(), 2u);
+    EXPECT_EQ(model.fans()[1].sensors, std::vector<std::string>{"fan1_0"});
+    EXPECT_EQ(model.findSensor("fan0_1"), &model.fans()[0]);
+    EXPECT_EQ(model.findSensor("fan2_0"), nullptr);
+
+    // Starts settled: 25 + 100 / (2 + 4 * 0.5 + 4 * 1.0)
+    EXPECT_DOUBLE_EQ(model.temperatures()[0].temperature, 37.5);
+
+    // Full speed on fan0 settles at 25 + 100 / 10
+    model.setTarget("fan0", 20000);
+    EXPECT_DOUBLE_EQ(model.fans()[0].target, 10000);
+
+    for (int i = 0; i < 600; i++)
+    {
+        model.step(1s);
+    }
+    EXPECT_NEAR(model.fans()[0].speed, 10000, 1e-6);
+    EXPECT_NEAR(model.temperatures()[0].temperature, 35.0, 1e-6);
+
+    EXPECT_THROW(model.setTarget("fan9", 0), std::runtime_error);
+}
+
+TEST(ThermalModelTest, DynamicsTest)
+{
+    ThermalModel model{config};
+
+    // A PWM fan with no time constant jumps straight to its target.
+    model.setTarget("fan1", 127.5);
+    model.step(1s);
+    EXPECT_DOUBLE_EQ(model.fans()[1].speed, 4000);
+
+    // The other one gets 1 - e^-1 of the way there in one time constant.
+    model.setTarget("fan0", 10000);
+    auto before = model.fans()[0].speed;
+    model.step(1s);
+    EXPECT_NEAR(model.fans()[0].speed - before,
+                (10000 - before) * (1 - std::exp(-1.0)), 1e-6);
+
+    // A failed fan spins down and the temperature goes up.
+    auto temp = model.temperatures()[0].temperature;
+    model.setFailed("fan0", true);
+    for (int i = 0; i < 10; i++)
+    {
+        model.step(1s);
+    }
+    EXPECT_LT(model.fans()[0].speed, 1.0);
+    EXPECT_GT(model.temperatures()[0].temperature, temp);
+}
+
+TEST(ThermalModelTest, BadConfigTest)
+{
+    auto bad = config;
+    bad["temperatures"][0]["cooling"]["fan7"] = 1.0;
+    EXPECT_THROW(ThermalModel{bad}, std::runtime_error);
+
+    bad = config;
+    bad["temperatures"][0]["conductance"] = 0;
+    EXPECT_THROW(ThermalModel{bad}, std::runtime_error);
+}
+
+TEST(ScenarioTest, AnalyzeTest)
+{
+    Scenario scenario{R"(
+    {
+        "duration": 100,
+        "stable_band": 0.5,
+        "stable_hold": 20,
+        "steps": [
+            {"at": 50, "name": "load", "loads": {"cpu0": 200}}
+        ]
+    }
+    )"_json};
+
+    ThermalModel model{config};
+
+    // Rises to 65 after the load step and is back within the band of 55
+    // at t=79.
+    for (int t = 0; t < 100; t++)
+    {
+        scenario.applySteps(t, model);
+
+        double temp = 40.0;
+        double target = 5000;
+        if (t >= 50)
+        {
+            temp = (t < 60) ? 40.0 + (t - 50) * 2.5 : 65.0 - (t - 60) * 0.5;
+            temp = std::max(temp, 55.0);
+            target = 10000;
+        }
+        scenario.addSample({double(t), {{"cpu0", temp}}, {{"fan0", target}}});
+    }
+    EXPECT_TRUE(scenario.done(100));
+
+    // The step changed the model's load.
+    EXPECT_EQ(model.temperatures()[0].load, 200);
+
+    auto result = scenario.analyze();
+    ASSERT_EQ(result.size(), 2u);
+
+    EXPECT_EQ(result[0]["name"], "start");
+    EXPECT_EQ(result[0]["time_to_stable_s"], 0.0);
+    EXPECT_EQ(result[0]["target_changes"], 0);
+
+    EXPECT_EQ(result[1]["name"], "load");
+    EXPECT_EQ(result[1]["time_to_stable_s"], 29.0);
+    EXPECT_EQ(result[1]["temperatures"]["cpu0"]["end"], 55.0);
+    EXPECT_EQ(result[1]["temperatures"]["cpu0"]["peak"], 65.0);
+    EXPECT_EQ(result[1]["temperatures"]["cpu0"]["overshoot"], 10.0);
+    EXPECT_EQ(result[1]["targets"]["fan0"], 10000);
+}
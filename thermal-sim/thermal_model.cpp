@@ -0,0 +1,177 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#include "thermal_model.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace phosphor::fan::sim
+{
+
+using json = nlohmann::json;
+
+ThermalModel::ThermalModel(const json& config) :
+    _ambient(config.value("ambient", 25.0))
+{
+    if (!config.contains("fans") || !config.contains("temperatures"))
+    {
+        throw std::runtime_error{
+            "Simulator config needs 'fans' and 'temperatures'"};
+    }
+
+    for (const auto& jsonFan : config["fans"])
+    {
+        FanModel fan;
+        fan.name = jsonFan.at("name").get<std::string>();
+        fan.sensors = jsonFan.value("sensors",
+                                    std::vector<std::string>{fan.name + "_0"});
+        fan.pwm = jsonFan.value("target_interface", "RPM") == "PWM";
+        fan.maxSpeed = jsonFan.value("max_speed", 10000.0);
+        fan.timeConstant = jsonFan.value("time_constant", 2.0);
+        fan.inventory = jsonFan.value(
+            "inventory", "/system/chassis/motherboard/" + fan.name);
+        fan.target = jsonFan.value("initial_target",
+                                   fan.pwm ? 255.0 : fan.maxSpeed);
+
+        if ((fan.maxSpeed <= 0.0) || (fan.timeConstant < 0.0))
+        {
+            throw std::runtime_error{"Fan " + fan.name +
+                                     " has an invalid speed or time constant"};
+        }
+
+        fan.speed = targetSpeed(fan);
+        _fans.push_back(std::move(fan));
+    }
+
+    for (const auto& jsonTemp : config["temperatures"])
+    {
+        TemperatureModel temp;
+        temp.name = jsonTemp.at("name").get<std::string>();
+        temp.load = jsonTemp.value("load", 0.0);
+        temp.conductance = jsonTemp.value("conductance", 1.0);
+        temp.cooling =
+            jsonTemp.value("cooling", std::map<std::string, double>{});
+        temp.timeConstant = jsonTemp.value("time_constant", 30.0);
+
+        for (const auto& [name, _] : temp.cooling)
+        {
+            fan(name);
+        }
+
+        if ((temp.conductance <= 0.0) || (temp.timeConstant < 0.0))
+        {
+            throw std::runtime_error{
+                "Temperature " + temp.name +
+                " has an invalid conductance or time constant"};
+        }
+
+        _temperatures.push_back(std::move(temp));
+    }
+
+    settle();
+}
+
+void ThermalModel::step(std::chrono::duration<double> dt)
+{
+    auto approach = [&dt](double value, double goal, double timeConstant) {
+        if (timeConstant <= 0.0)
+        {
+            return goal;
+        }
+        return goal + (value - goal) * std::exp(-dt.count() / timeConstant);
+    };
+
+    for (auto& fan : _fans)
+    {
+        fan.speed = approach(fan.speed, targetSpeed(fan), fan.timeConstant);
+    }
+
+    for (auto& temp : _temperatures)
+    {
+        temp.temperature =
+            approach(temp.temperature, steadyState(temp), temp.timeConstant);
+    }
+}
+
+void ThermalModel::settle()
+{
+    for (auto& temp : _temperatures)
+    {
+        temp.temperature = steadyState(temp);
+    }
+}
+
+void ThermalModel::setTarget(const std::string& name, double target)
+{
+    auto& f = fan(name);
+    f.target = std::clamp(target, 0.0, f.pwm ? 255.0 : f.maxSpeed);
+}
+
+void ThermalModel::setLoad(const std::string& sensor, double load)
+{
+    temperature(sensor).load = load;
+}
+
+void ThermalModel::setFailed(const std::string& name, bool failed)
+{
+    fan(name).failed = failed;
+}
+
+const FanModel* ThermalModel::findSensor(const std::string& sensor) const
+{
+    auto it = std::find_if(_fans.begin(), _fans.end(), [&sensor](auto& fan) {
+        return std::find(fan.sensors.begin(), fan.sensors.end(), sensor) !=
+               fan.sensors.end();
+    });
+    return (it != _fans.end()) ? &*it : nullptr;
+}
+
+FanModel& ThermalModel::fan(const std::string& name)
+{
+    auto it = std::find_if(_fans.begin(), _fans.end(),
+                           [&name](auto& fan) { return fan.name == name; });
+    if (it == _fans.end())
+    {
+        throw std::runtime_error{"Unknown fan " + name};
+    }
+    return *it;
+}
+
+TemperatureModel& ThermalModel::temperature(const std::string& name)
+{
+    auto it =
+        std::find_if(_temperatures.begin(), _temperatures.end(),
+                     [&name](auto& temp) { return temp.name == name; });
+    if (it == _temperatures.end())
+    {
+        throw std::runtime_error{"Unknown temperature sensor " + name};
+    }
+    return *it;
+}
+
+double ThermalModel::steadyState(const TemperatureModel& temp) const
+{
+    double conductance = temp.conductance;
+
+    for (const auto& [name, cooling] : temp.cooling)
+    {
+        auto it = std::find_if(_fans.begin(), _fans.end(),
+                               [&name](auto& fan) { return fan.name == name; });
+        conductance += cooling * it->speed / it->maxSpeed;
+    }
+
+    return _ambient + temp.load / conductance;
+}
+
+double ThermalModel::targetSpeed(const FanModel& fan) const
+{
+    if (fan.failed)
+    {
+        return 0.0;
+    }
+    return fan.pwm ? fan.target / 255.0 * fan.maxSpeed : fan.target;
+}
+
+} // namespace phosphor::fan::sim
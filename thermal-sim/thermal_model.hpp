@@ -0,0 +1,197 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace phosphor::fan::sim
+{
+
+/**
+ * @brief A simulated fan
+ */
+struct FanModel
+{
+    std::string name;
+
+    /**
+     * @brief The tach sensor names, under .../sensors/fan_tach/
+     */
+    std::vector<std::string> sensors;
+
+    /**
+     * @brief If the target is a PWM value from 0 to 255 instead of RPM
+     */
+    bool pwm = false;
+
+    /**
+     * @brief The speed in RPM at the maximum target
+     */
+    double maxSpeed = 10000.0;
+
+    /**
+     * @brief How many seconds the speed takes to get about 63% of the
+     *        way to a new target
+     */
+    double timeConstant = 2.0;
+
+    /**
+     * @brief The inventory path, under /xyz/openbmc_project/inventory
+     */
+    std::string inventory;
+
+    double target = 0.0;
+    double speed = 0.0;
+
+    /**
+     * @brief If the fan has failed and stopped spinning
+     */
+    bool failed = false;
+};
+
+/**
+ * @brief A simulated temperature sensor
+ */
+struct TemperatureModel
+{
+    std::string name;
+
+    /**
+     * @brief The heat load in watts
+     */
+    double load = 0.0;
+
+    /**
+     * @brief The watts per degree removed with the fans stopped
+     */
+    double conductance = 1.0;
+
+    /**
+     * @brief The watts per degree removed by each fan at full speed,
+     *        which scales with the fan's speed.
+     */
+    std::map<std::string, double> cooling;
+
+    /**
+     * @brief How many seconds the temperature takes to get about 63%
+     *        of the way to a new steady state
+     */
+    double timeConstant = 30.0;
+
+    double temperature = 0.0;
+};
+
+/**
+ * @class ThermalModel
+ *
+ * A simple lumped model of a system cooled by fans.
+ *
+ * Each temperature settles at the ambient plus its load divided by
+ * how well it is cooled, which is its conductance plus the cooling of
+ * each fan scaled by the fan's speed.  Both the temperatures and the
+ * fan speeds move toward where they are headed exponentially with
+ * their time constants, so the model is stable for any step size.
+ */
+class ThermalModel
+{
+  public:
+    ThermalModel() = delete;
+    ~ThermalModel() = default;
+    ThermalModel(const ThermalModel&) = default;
+    ThermalModel& operator=(const ThermalModel&) = default;
+    ThermalModel(ThermalModel&&) = default;
+    ThermalModel& operator=(ThermalModel&&) = default;
+
+    /**
+     * @brief Constructor
+     *
+     * Throws std::runtime_error on an invalid config.
+     *
+     * @param[in] config - The 'ambient', 'fans', and 'temperatures'
+     *                     sections of the simulator config
+     */
+    explicit ThermalModel(const nlohmann::json& config);
+
+    /**
+     * @brief Advances the model.
+     *
+     * @param[in] dt - How far to advance it
+     */
+    void step(std::chrono::duration<double> dt);
+
+    /**
+     * @brief Starts every temperature at its steady state for the
+     *        current fan targets.
+     */
+    void settle();
+
+    /**
+     * @brief Sets a fan's target, in RPM or PWM.
+     */
+    void setTarget(const std::string& fan, double target);
+
+    /**
+     * @brief Sets a temperature sensor's heat load in watts.
+     */
+    void setLoad(const std::string& sensor, double load);
+
+    /**
+     * @brief Sets the ambient temperature.
+     */
+    void setAmbient(double ambient)
+    {
+        _ambient = ambient;
+    }
+
+    /**
+     * @brief Fails or repairs a fan.
+     */
+    void setFailed(const std::string& fan, bool failed);
+
+    const std::vector<FanModel>& fans() const
+    {
+        return _fans;
+    }
+
+    const std::vector<TemperatureModel>& temperatures() const
+    {
+        return _temperatures;
+    }
+
+    /**
+     * @brief Returns the fan that has a tach sensor, or nullptr.
+     */
+    const FanModel* findSensor(const std::string& sensor) const;
+
+  private:
+    FanModel& fan(const std::string& name);
+
+    TemperatureModel& temperature(const std::string& name);
+
+    /**
+     * @brief Returns where a temperature is headed at the current
+     *        fan speeds.
+     */
+    double steadyState(const TemperatureModel& temp) const;
+
+    /**
+     * @brief Returns the speed a fan is headed to.
+     */
+    double targetSpeed(const FanModel& fan) const;
+
+    /**
+     * @brief The ambient temperature
+     */
+    double _ambient = 25.0;
+
+    std::vector<FanModel> _fans;
+    std::vector<TemperatureModel> _temperatures;
+};
+
+} // namespace phosphor::fan::sim